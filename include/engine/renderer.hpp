@@ -20,33 +20,58 @@
 #include "engine/vulkan/fence.hpp"
 #include "engine/vulkan/command_pool.hpp"
 #include "engine/vulkan/pipeline.hpp"
+#include "engine/vulkan/pipeline_library.hpp"
 #include "engine/vulkan/commands.hpp"
 #include "engine/vulkan/queue.hpp"
 
 #include "shader_library.hpp"
+#include "shader_watcher.hpp"
 
 //#include "vulkan/global/instance.hpp"
 #include "engine/vertex/vertex.hpp"
 #include "engine/vertex/position.hpp"
+#include "engine/vertex/column.hpp"
+#include "engine/vertex/input_layout.hpp"
 
 #include "engine/vulkan/device_memory.hpp"
 #include "engine/vulkan/memory_buffer.hpp"
-#include "engine/vulkan/sync.hpp"
+#include "engine/vulkan/frame_pacer.hpp"
 
 #include "renderx/vulkan/allocator.hpp"
+#include "renderx/vulkan/uploader.hpp"
+#include "renderx/vulkan/geometry_pool.hpp"
+#include "renderx/vulkan/defragmenter.hpp"
+#include "renderx/vulkan/parallel_recorder.hpp"
+#include "renderx/vulkan/frame_uniforms.hpp"
+#include "renderx/vulkan/dirty_ranges.hpp"
+#include "renderx/vulkan/frame_ring.hpp"
+#include "renderx/vulkan/state_tracker.hpp"
+#include "renderx/vulkan/instance_batcher.hpp"
+#include "renderx/vulkan/gpu_culler.hpp"
 #include "renderx/vulkan/index_buffer.hpp"
 #include "renderx/vulkan/vertex_buffer.hpp"
 #include "renderx/shapes/cuboid.hpp"
 #include "renderx/mesh.hpp"
+#include "renderx/render_queue.hpp"
 #include "renderx/object.hpp"
 #include "renderx/camera.hpp"
 
 #include "renderx/glfw/events.hpp"
 
+#include <atomic>
+#include <memory>
+
 // to be removed !
 using vertex_type = engine::vertex<vx::float3,
 								   vx::float3>;
 
+// per-instance model matrix (four columns)
+using instance_type = engine::vertex<vx::float4, vx::float4,
+									 vx::float4, vx::float4>;
+
+// vertex stream + instance stream
+using layout_type = engine::input_layout<vertex_type, instance_type>;
+
 
 
 // -- E N G I N E  N A M E S P A C E ------------------------------------------
@@ -67,11 +92,22 @@ namespace engine {
 			using ___self = engine::renderer;
 
 
+			// -- private constants -------------------------------------------
+
+			enum : vk::u32 {
+				/* batch count (draw calls) from which recording is split across workers */
+				___PARALLEL_THRESHOLD___ = 1024U
+			};
+
+
 			// -- private members ---------------------------------------------
 
 			/* queue */
 			vulkan::queue _queue;
 
+			/* transfer queue (dedicated family when available) */
+			vulkan::queue _transfer;
+
 			/* swapchain */
 			vulkan::swapchain _swapchain;
 
@@ -81,19 +117,39 @@ namespace engine {
 			///* command buffers */
 			vulkan::commands<vulkan::primary> _cmds;
 
+			/* host visible allocator (shared by streaming buffers) */
+			vulkan::allocator<vulkan::cpu_coherent> _host;
+
+			/* host cached allocator (per frame writes, flushed explicitly) */
+			vulkan::allocator<vulkan::cpu_cached> _cached;
+
+			/* cached ranges written this frame (flushed before submit) */
+			vulkan::dirty_ranges _dirty;
+
 
 			/* shader library */
 			shader_library _shaders;
 
+			/* camera uniforms (one slot per swapchain image) */
+			vulkan::frame_uniforms<glm::mat4> _uniforms;
+
+			/* pipeline library (deduplicated by state) */
+			vulkan::pipeline_library _pipelines;
 
-			/* pipeline */
-			vulkan::pipeline _pipeline;
+			/* pipeline (compiled in background, draws skipped until ready) */
+			vulkan::pipeline_library::handle _pipeline;
 
 			/* device memory */
 			vulkan::device_memory _memory;
 
-			/* sync */
-			vulkan::sync<3U> _sync;
+			/* frame pacing (timeline semaphore) */
+			vulkan::frame_pacer _pacer;
+
+			/* per frame ring (immediate mode instance streams, reset by the pacer) */
+			vulkan::frame_ring<vulkan::cpu_cached> _transient;
+
+			/* frame submission (storage reused every frame) */
+			vulkan::submission _submission;
 
 			/* mesh */
 			xns::vector<rx::mesh> _meshes;
@@ -101,7 +157,53 @@ namespace engine {
 			/* objects */
 			vk::vector<rx::object> _objects;
 
-			vulkan::allocator<vulkan::cpu_coherent> _allocator;
+			/* sorted draws (object payloads) */
+			rx::render_queue _draws;
+
+			/* instanced batches (one stream per swapchain image) */
+			vulkan::instance_batcher<glm::mat4> _instances;
+
+			/* device local allocator */
+			vulkan::allocator<vulkan::gpu> _allocator;
+
+			/* staging uploader */
+			vulkan::uploader _uploader;
+
+			/* incremental defragmenter */
+			vulkan::defragmenter<vulkan::gpu> _defrag;
+
+			/* shared vertex / index buffers (relocated by defragmenter) */
+			vulkan::geometry_pool<vertex_type, vk::u16> _geometry;
+
+			/* compute culling / indirect draws (one slot per swapchain image) */
+			vulkan::gpu_culler _culler;
+
+			/* secondary command recorder (one slot per swapchain image) */
+			vulkan::parallel_recorder _recorder;
+
+			/* threaded recording enabled */
+			bool _threaded;
+
+			/* retained recording enabled */
+			bool _retained;
+
+			/* gpu driven drawing enabled */
+			bool _gpu_driven;
+
+			/* scene version (bumped on invalidate) */
+			vk::u64 _version;
+
+			/* scene version recorded per swapchain image */
+			std::vector<vk::u64> _recorded;
+
+			/* last timeline value submitted per swapchain image */
+			std::vector<vk::u64> _image_values;
+
+			/* redundant state commands dropped while recording (lifetime) */
+			std::atomic<vk::u64> _redundant;
+
+			/* shader watcher (hot reload, development only) */
+			std::unique_ptr<engine::shader_watcher> _watcher;
 
 			/* camera */
 			rx::camera _camera;
@@ -141,6 +243,56 @@ namespace engine {
 			/* run */
 			auto run(void) -> void;
 
+			/* memory stats */
+			auto memory_stats(void) const -> vulkan::memory_stats;
+
+			/* frames in flight (1 for latency, more for throughput) */
+			auto frames_in_flight(const vk::u32) noexcept -> void;
+
+			/* threaded recording (large scenes only) */
+			auto threaded_recording(const bool) noexcept -> void;
+
+			/* retained recording (re-record only after invalidate) */
+			auto retained_recording(const bool) noexcept -> void;
+
+			/* gpu driven drawing (compute culling, indirect draws when supported) */
+			auto gpu_driven(const bool) noexcept -> void;
+
+			/* hot reload (watch shader sources, rebuild dependent pipelines) */
+			auto hot_reload(const bool) -> void;
+
+			/* invalidate (objects, meshes or pipeline changed) */
+			auto invalidate(void) noexcept -> void;
+
+			/* redundant binds (dropped by state tracking) */
+			auto redundant_binds(void) const noexcept -> vk::u64;
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* wait image (previous submission using this image) */
+			auto _wait_image(const vk::u32&) -> void;
+
+			/* record (image command buffer) */
+			auto _record(const vk::u32&) -> void;
+
+			/* record indirect (culled on gpu, inside the render pass) */
+			auto _record_indirect(const vk::u32&) -> void;
+
+			/* reload shaders (swap rebuilt pipelines, release retired ones) */
+			auto _reload_shaders(void) -> void;
+
+			/* save pipelines (failures are logged, never stop the loop) */
+			auto _save_pipelines(void) noexcept -> void;
+
+			/* sort draws (state first, then front to back) */
+			auto _sort_draws(void) -> void;
+
+			/* batch draws (sorted draws sharing a mesh become one instanced draw) */
+			auto _batch_draws(const vk::u32&) -> void;
+
 	}; // class renderer
 
 } // namespace engine
@@ -21,6 +21,8 @@
 
 #include <unordered_map>
 #include <map>
+#include <mutex>
+#include <stdexcept>
 
 #include <xns/string.hpp>
 #include <xns/literal_map.hpp>
@@ -81,14 +83,32 @@ namespace engine {
 			template <vk::shader_stage_flag_bits ___stage>
 			using ___map = std::unordered_map<std::string, vulkan::shader_module<___stage>>;
 
+			/* index type (module name to spirv path) */
+			using ___index = std::unordered_map<std::string, std::string>;
+
 
 			// -- private members ---------------------------------------------
 
-			/* vertex modules */
-			___map<VK_SHADER_STAGE_VERTEX_BIT> _vmodules;
+			/* vertex modules (created on first request) */
+			mutable ___map<VK_SHADER_STAGE_VERTEX_BIT> _vmodules;
+
+			/* fragment shaders (created on first request) */
+			mutable ___map<VK_SHADER_STAGE_FRAGMENT_BIT> _fmodules;
+
+			/* compute shaders (created on first request) */
+			mutable ___map<VK_SHADER_STAGE_COMPUTE_BIT> _cmodules;
+
+			/* vertex paths */
+			___index _vpaths;
+
+			/* fragment paths */
+			___index _fpaths;
+
+			/* compute paths */
+			___index _cpaths;
 
-			/* fragment shaders */
-			___map<VK_SHADER_STAGE_FRAGMENT_BIT> _fmodules;
+			/* module lock (pipelines compile on worker threads) */
+			mutable std::mutex _mutex;
 
 
 			// -- private static members --------------------------------------
@@ -96,47 +116,51 @@ namespace engine {
 			using ___fn = auto (___self::*)(const std::string&) -> void;
 
 
-			/* load vertex */
-			auto load_vertex(const std::string& path) -> void {
-
-				xns::string p{path.data(), path.size()};
+			/* index vertex */
+			auto index_vertex(const std::string& path) -> void {
 
 				// get base name
 				const auto name = std::filesystem::path{path}.stem().string();
 
-				// check if already loaded
-				if (_vmodules.find(name) != _vmodules.end())
-					throw std::runtime_error{"shader already loaded"};
+				// check if already indexed
+				if (_vpaths.find(name) != _vpaths.end())
+					throw std::runtime_error{"shader already indexed"};
 
-				_vmodules[name] = vulkan::shader_module<VK_SHADER_STAGE_VERTEX_BIT>{p};
+				_vpaths[name] = path;
 			}
 
-			/* load fragment */
-			auto load_fragment(const std::string& path) -> void {
+			/* index fragment */
+			auto index_fragment(const std::string& path) -> void {
 
-				xns::string p{path.data(), path.size()};
 				const auto name = std::filesystem::path{path}.stem().string();
 
-				if (_fmodules.find(name) != _fmodules.end())
-					throw;
+				if (_fpaths.find(name) != _fpaths.end())
+					throw std::runtime_error{"shader already indexed"};
 
-				_fmodules[name] = vulkan::shader_module<VK_SHADER_STAGE_FRAGMENT_BIT>{p};
+				_fpaths[name] = path;
 			}
 
-			/* load compute */
-			auto load_compute(const std::string& path) -> void {
+			/* index compute */
+			auto index_compute(const std::string& path) -> void {
+
+				const auto name = std::filesystem::path{path}.stem().string();
+
+				if (_cpaths.find(name) != _cpaths.end())
+					throw std::runtime_error{"shader already indexed"};
+
+				_cpaths[name] = path;
 			}
 
-			/* load tessellation control */
-			auto load_tess_control(const std::string& path) -> void {
+			/* index tessellation control */
+			auto index_tess_control(const std::string& path) -> void {
 			}
 
-			/* load tessellation evaluation */
-			auto load_tess_eval(const std::string& path) -> void {
+			/* index tessellation evaluation */
+			auto index_tess_eval(const std::string& path) -> void {
 			}
 
-			/* load geometry */
-			auto load_geometry(const std::string& path) -> void {
+			/* index geometry */
+			auto index_geometry(const std::string& path) -> void {
 			}
 
 
@@ -153,28 +177,28 @@ namespace engine {
 				std::unordered_map<std::string, ___fn> _stages;
 
 				// vertex
-				_stages["vertex"]      = &___self::load_vertex;
-				_stages["vert"]        = &___self::load_vertex;
+				_stages["vertex"]      = &___self::index_vertex;
+				_stages["vert"]        = &___self::index_vertex;
 
 				// fragment
-				_stages["fragment"]    = &___self::load_fragment;
-				_stages["frag"]        = &___self::load_fragment;
+				_stages["fragment"]    = &___self::index_fragment;
+				_stages["frag"]        = &___self::index_fragment;
 
 				// tessellation control
-				_stages["tesscontrol"] = &___self::load_tess_control;
-				_stages["tesc"]        = &___self::load_tess_control;
+				_stages["tesscontrol"] = &___self::index_tess_control;
+				_stages["tesc"]        = &___self::index_tess_control;
 
 				// tessellation evaluation
-				_stages["tesseval"]    = &___self::load_tess_eval;
-				_stages["tese"]        = &___self::load_tess_eval;
+				_stages["tesseval"]    = &___self::index_tess_eval;
+				_stages["tese"]        = &___self::index_tess_eval;
 
 				// geometry
-				_stages["geometry"]    = &___self::load_geometry;
-				_stages["geom"]        = &___self::load_geometry;
+				_stages["geometry"]    = &___self::index_geometry;
+				_stages["geom"]        = &___self::index_geometry;
 
 				// compute
-				_stages["compute"]     = &___self::load_compute;
-				_stages["comp"]        = &___self::load_compute;
+				_stages["compute"]     = &___self::index_compute;
+				_stages["comp"]        = &___self::index_compute;
 
 				return _stages;
 			}
@@ -295,7 +319,10 @@ namespace engine {
 
 			/* default constructor */
 			shader_library(void)
-			: _vmodules{}, _fmodules{} {
+			: _vmodules{}, _fmodules{}, _cmodules{},
+			  _vpaths{}, _fpaths{}, _cpaths{}, _mutex{} {
+
+				// index only, modules are created on first request
 
 				// root
 				constexpr std::string_view root{"shaders/spirv/"};
@@ -335,11 +362,11 @@ namespace engine {
 			}
 
 
-			/* copy constructor */
-			shader_library(const ___self&) = default;
+			/* deleted copy constructor */
+			shader_library(const ___self&) = delete;
 
-			/* move constructor */
-			shader_library(___self&&) noexcept = default;
+			/* deleted move constructor */
+			shader_library(___self&&) = delete;
 
 			/* destructor */
 			~shader_library(void) noexcept = default;
@@ -348,41 +375,107 @@ namespace engine {
 
 			// -- public modifiers --------------------------------------------
 
+			/* reload (spirv path, replaces module of same stage and name,
+			 * old module is kept when the new one fails to load) */
+			auto reload(const std::string& path) -> vk::shader_stage_flag_bits {
 
-			// -- public accessors --------------------------------------------
+				xns::string p{path.data(), path.size()};
 
-			/* get vertex module */
-			auto vertex_module(const std::string& name) const -> const vulkan::vertex_module& {
+				const std::filesystem::path file{path};
 
-				const auto res = _vmodules.find(name);
+				// stage from parent directory, module name from file stem
+				const auto parent = file.parent_path().filename().string();
+				const auto name   = file.stem().string();
 
-				if (res == _vmodules.end())
-					throw;
+				const auto stage = get_stage_flag(parent.data(), static_cast<vk::u32>(parent.size()));
+
+				const std::lock_guard<std::mutex> lock{_mutex};
+
+				// created now, not lazily, so a broken file is caught here
+				switch (stage) {
+
+					case VK_SHADER_STAGE_VERTEX_BIT:
+						_vmodules[name] = vulkan::vertex_module{p};
+						_vpaths[name]   = path;
+						break;
 
-				return res->second;
+					case VK_SHADER_STAGE_FRAGMENT_BIT:
+						_fmodules[name] = vulkan::fragment_module{p};
+						_fpaths[name]   = path;
+						break;
+
+					case VK_SHADER_STAGE_COMPUTE_BIT:
+						_cmodules[name] = vulkan::compute_module{p};
+						_cpaths[name]   = path;
+						break;
+
+					default:
+						throw std::runtime_error{"shader stage not supported"};
+				}
+
+				return stage;
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* get vertex module */
+			auto vertex_module(const std::string& name) const -> const vulkan::vertex_module& {
+				return ___self::_module(_vmodules, _vpaths, name);
 			}
 
 			/* get fragment module */
 			auto fragment_module(const std::string& name) const -> const vulkan::fragment_module& {
+				return ___self::_module(_fmodules, _fpaths, name);
+			}
 
-				const auto res = _fmodules.find(name);
+			/* get compute module */
+			auto compute_module(const std::string& name) const -> const vulkan::compute_module& {
+				return ___self::_module(_cmodules, _cpaths, name);
+			}
 
-				if (res == _fmodules.end())
-					throw;
+			/* has compute module */
+			auto has_compute_module(const std::string& name) const -> bool {
+
+				const std::lock_guard<std::mutex> lock{_mutex};
 
-				return res->second;
+				return _cpaths.find(name) != _cpaths.end();
 			}
 
+			/* loaded (modules created so far) */
+			auto loaded(void) const -> vk::u32 {
+
+				const std::lock_guard<std::mutex> lock{_mutex};
+
+				return static_cast<vk::u32>(_vmodules.size() + _fmodules.size() + _cmodules.size());
+			}
 
 
 		private:
 
+			// -- private methods ---------------------------------------------
 
+			/* module (cached, mapped and created on first request) */
+			template <vk::shader_stage_flag_bits ___stage>
+			auto _module(___map<___stage>& modules,
+						 const ___index& paths,
+						 const std::string& name) const -> const vulkan::shader_module<___stage>& {
 
+				const std::lock_guard<std::mutex> lock{_mutex};
 
+				if (const auto res = modules.find(name); res != modules.end())
+					return res->second;
 
-			// -- private types -----------------------------------------------
+				const auto path = paths.find(name);
+
+				if (path == paths.end())
+					throw std::runtime_error{"shader not found"};
 
+				xns::string p{path->second.data(), path->second.size()};
+
+				// node references stay valid across later insertions
+				return modules.emplace(name, vulkan::shader_module<___stage>{p}).first->second;
+			}
 
 	}; // class shader_library
 
@@ -0,0 +1,109 @@
+/*****************************************************************************/
+/*                                                                           */
+/*          ░  ░░░░  ░  ░░░░  ░  ░░░░░░░  ░░░░  ░░      ░░   ░░░  ░          */
+/*          ▒  ▒▒▒▒  ▒  ▒▒▒▒  ▒  ▒▒▒▒▒▒▒  ▒▒▒  ▒▒  ▒▒▒▒  ▒    ▒▒  ▒          */
+/*          ▓▓  ▓▓  ▓▓  ▓▓▓▓  ▓  ▓▓▓▓▓▓▓     ▓▓▓▓  ▓▓▓▓  ▓  ▓  ▓  ▓          */
+/*          ███    ███  ████  █  ███████  ███  ██        █  ██    █          */
+/*          ████  █████      ██        █  ████  █  ████  █  ███   █          */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef ___ENGINE_SHADER_WATCHER___
+#define ___ENGINE_SHADER_WATCHER___
+
+#include "engine/os.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- S H A D E R  W A T C H E R ------------------------------------------
+
+	class shader_watcher final {
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = engine::shader_watcher;
+
+
+			// -- private members ---------------------------------------------
+
+			/* inotify descriptor */
+			int _fd;
+
+			/* watched stage directories (watch descriptor to stage name) */
+			std::unordered_map<int, std::string> _stages;
+
+			/* compiled spirv paths not yet taken */
+			std::vector<std::string> _compiled;
+
+			/* compiled lock */
+			std::mutex _mutex;
+
+			/* stop flag */
+			std::atomic<bool> _stop;
+
+			/* compile thread */
+			std::thread _thread;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor (watches shaders/sources, development only) */
+			shader_watcher(void);
+
+			/* deleted copy constructor */
+			shader_watcher(const ___self&) = delete;
+
+			/* deleted move constructor */
+			shader_watcher(___self&&) = delete;
+
+			/* destructor */
+			~shader_watcher(void) noexcept;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* take (spirv files compiled since last call, non-blocking) */
+			auto take(void) -> std::vector<std::string>;
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* run (watch loop) */
+			auto _run(void) -> void;
+
+			/* compile (one glsl source, written beside then renamed) */
+			auto _compile(const std::string&, const std::string&) -> void;
+
+	}; // class shader_watcher
+
+} // namespace engine
+
+#endif // ___ENGINE_SHADER_WATCHER___
@@ -0,0 +1,114 @@
+/*****************************************************************************/
+/*                                                                           */
+/*          ░  ░░░░  ░  ░░░░  ░  ░░░░░░░  ░░░░  ░░      ░░   ░░░  ░          */
+/*          ▒  ▒▒▒▒  ▒  ▒▒▒▒  ▒  ▒▒▒▒▒▒▒  ▒▒▒  ▒▒  ▒▒▒▒  ▒    ▒▒  ▒          */
+/*          ▓▓  ▓▓  ▓▓  ▓▓▓▓  ▓  ▓▓▓▓▓▓▓     ▓▓▓▓  ▓▓▓▓  ▓  ▓  ▓  ▓          */
+/*          ███    ███  ████  █  ███████  ███  ██        █  ██    █          */
+/*          ████  █████      ██        █  ████  █  ████  █  ███   █          */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef ___ENGINE_COLUMN_HEADER___
+#define ___ENGINE_COLUMN_HEADER___
+
+#include "engine/vk/format.hpp"
+
+
+// -- V X  N A M E S P A C E --------------------------------------------------
+
+namespace vx {
+
+
+	// -- C O L U M N ---------------------------------------------------------
+
+	template <vk::u32 ___size, typename ___type>
+	class column final {
+
+
+		// -- assertions ------------------------------------------------------
+
+		/* check size */
+		static_assert(___size >= 2U && ___size <= 4U,
+			"vertex column size must be between 2 and 4");
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vx::column<___size, ___type>;
+
+
+			// -- private members ---------------------------------------------
+
+			/* data */
+			___type _data[___size];
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* value type */
+			using value_type = ___type;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor */
+			constexpr column(void) noexcept
+			: _data{} {
+			}
+
+			/* member constructor */
+			template <typename... ___params>
+			constexpr column(const ___params&... ___args) noexcept
+			: _data{static_cast<value_type>(___args)...} {
+			}
+
+			/* copy constructor */
+			constexpr column(const ___self&) noexcept = default;
+
+			/* move constructor */
+			constexpr column(___self&&) noexcept = default;
+
+			/* destructor */
+			constexpr ~column(void) noexcept = default;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* copy assignment operator */
+			auto operator=(const ___self&) noexcept -> ___self& = default;
+
+			/* move assignment operator */
+			auto operator=(___self&&) noexcept -> ___self& = default;
+
+
+			// -- public accessors --------------------------------------------
+
+			/* subscript operator */
+			constexpr auto operator[](const vk::u32& ___index) const noexcept -> value_type {
+				return _data[___index];
+			}
+
+
+			// -- public static methods ---------------------------------------
+
+			/* format */
+			static consteval auto format(void) noexcept -> vk::format {
+				return vk::pixel_format<value_type, ___size>();
+			}
+
+	}; // class column
+
+
+	// -- aliases -------------------------------------------------------------
+
+	/* float4 (one shader location, four of them make a mat4) */
+	using float4 = vx::column<4U, float>;
+
+} // namespace vx
+
+#endif // ___ENGINE_COLUMN_HEADER___
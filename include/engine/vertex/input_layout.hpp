@@ -0,0 +1,159 @@
+/*****************************************************************************/
+/*                                                                           */
+/*          ░  ░░░░  ░  ░░░░  ░  ░░░░░░░  ░░░░  ░░      ░░   ░░░  ░          */
+/*          ▒  ▒▒▒▒  ▒  ▒▒▒▒  ▒  ▒▒▒▒▒▒▒  ▒▒▒  ▒▒  ▒▒▒▒  ▒    ▒▒  ▒          */
+/*          ▓▓  ▓▓  ▓▓  ▓▓▓▓  ▓  ▓▓▓▓▓▓▓     ▓▓▓▓  ▓▓▓▓  ▓  ▓  ▓  ▓          */
+/*          ███    ███  ████  █  ███████  ███  ██        █  ██    █          */
+/*          ████  █████      ██        █  ████  █  ████  █  ███   █          */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef ___ENGINE_INPUT_LAYOUT_HEADER___
+#define ___ENGINE_INPUT_LAYOUT_HEADER___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vertex/vertex.hpp"
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- I N P U T  L A Y O U T ----------------------------------------------
+
+	/* per-vertex stream at binding 0, per-instance stream at binding 1,
+	 * instance locations follow the vertex ones */
+	template <typename ___vertex, typename ___instance>
+	class input_layout final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* vertex type */
+			using vertex_type   = ___vertex;
+
+			/* instance type */
+			using instance_type = ___instance;
+
+			/* size type */
+			using size_type     = vk::u32;
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = engine::input_layout<___vertex, ___instance>;
+
+
+			// -- private constants -------------------------------------------
+
+			enum : size_type {
+				/* vertex binding */
+				___VERTEX_BINDING___   = 0U,
+				/* instance binding */
+				___INSTANCE_BINDING___ = 1U,
+				/* attribute count */
+				___ATTRIBUTES___       = ___vertex::attribute_count + ___instance::attribute_count
+			};
+
+
+			// -- private structs ---------------------------------------------
+
+			/* merged attributes */
+			struct ___attributes final {
+
+				/* descriptions */
+				vk::vertex_input_attribute_description data[___ATTRIBUTES___];
+
+			}; // struct ___attributes
+
+
+			// -- private static members --------------------------------------
+
+			/* attribute descriptions (merged at compile time) */
+			static constexpr ___attributes _attributes = []() consteval -> ___attributes {
+
+				___attributes merged{};
+
+				const auto* vertex   = ___vertex::template attributes<___VERTEX_BINDING___, 0U>();
+				const auto* instance = ___instance::template attributes<___INSTANCE_BINDING___,
+																		 ___vertex::attribute_count>();
+
+				for (size_type i = 0U; i < ___vertex::attribute_count; ++i)
+					merged.data[i] = vertex[i];
+
+				for (size_type i = 0U; i < ___instance::attribute_count; ++i)
+					merged.data[___vertex::attribute_count + i] = instance[i];
+
+				return merged;
+			}();
+
+			/* binding descriptions */
+			static constexpr vk::vertex_input_binding_description _bindings[2U] {
+				{
+					// binding index
+					___VERTEX_BINDING___,
+					// stride
+					___vertex::stride,
+					// input rate
+					VK_VERTEX_INPUT_RATE_VERTEX // advance for each vertex
+				},
+				{
+					// binding index
+					___INSTANCE_BINDING___,
+					// stride
+					___instance::stride,
+					// input rate
+					VK_VERTEX_INPUT_RATE_INSTANCE // advance for each instance
+				}
+			};
+
+			/* vertex input state info */
+			static constexpr vk::pipeline_vertex_input_state_info _info{
+				// structure type
+				VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+				// next structure
+				nullptr,
+				// flags
+				0U,
+				// binding description count
+				2U,
+				// vertex binding descriptions
+				_bindings,
+				// vertex attribute description count
+				___ATTRIBUTES___,
+				// vertex attribute descriptions
+				_attributes.data
+			};
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instantiable class */
+			___xns_not_instantiable(input_layout);
+
+
+			// -- public static methods ---------------------------------------
+
+			/* pipeline vertex input state info */
+			static constexpr auto info(void) noexcept -> const vk::pipeline_vertex_input_state_info& {
+				return ___self::_info;
+			}
+
+			/* instance binding */
+			static constexpr auto instance_binding(void) noexcept -> size_type {
+				return ___INSTANCE_BINDING___;
+			}
+
+	}; // class input_layout
+
+} // namespace engine
+
+#endif // ___ENGINE_INPUT_LAYOUT_HEADER___
@@ -283,12 +283,12 @@ namespace engine {
 
 
 			/* forward declaration */
-			template <typename>
+			template <typename, size_type, size_type>
 			struct ___descriptions;
 
-			/* descriptions */
-			template <size_type... ___idxs>
-			struct ___descriptions<___sequence<___idxs...>> final {
+			/* descriptions (binding index, first shader location) */
+			template <size_type... ___idxs, size_type ___binding, size_type ___first>
+			struct ___descriptions<___sequence<___idxs...>, ___binding, ___first> final {
 
 
 				// -- lifecycle -----------------------------------------------
@@ -303,9 +303,9 @@ namespace engine {
 				static constexpr vk::vertex_input_attribute_description _descriptions[sizeof...(___types)] {
 					{
 						// shader location
-						.location = ___idxs,
+						.location = ___first + ___idxs,
 						// binding index
-						.binding  = 0U,
+						.binding  = ___binding,
 						// format
 						.format   = ___type_at<___idxs>::format(),
 						// offset
@@ -317,7 +317,7 @@ namespace engine {
 
 
 			/* description type */
-			using ___descriptions_type = ___descriptions<___make_sequence>;
+			using ___descriptions_type = ___descriptions<___make_sequence, 0U, 0U>;
 
 
 			// -- private static members --------------------------------------
@@ -353,6 +353,15 @@ namespace engine {
 
 		public:
 
+			// -- public static members ---------------------------------------
+
+			/* attribute count */
+			static constexpr size_type attribute_count = sizeof...(___types);
+
+			/* stride */
+			static constexpr size_type stride = sizeof(___impl_type);
+
+
 			// -- public lifecycle --------------------------------------------
 
 			/* default constructor */
@@ -395,6 +404,12 @@ namespace engine {
 				return static_cast<const void*>(&_impl);
 			}
 
+			/* get (attribute at index) */
+			template <size_type ___idx>
+			constexpr auto get(void) const noexcept -> const ___type_at<___idx>& {
+				return static_cast<const ___wrapper_at<___idx>&>(_impl).value;
+			}
+
 
 			// -- public static methods ---------------------------------------
 
@@ -403,6 +418,12 @@ namespace engine {
 				return ___self::_info;
 			}
 
+			/* attribute descriptions (relocated to binding / first location) */
+			template <size_type ___binding, size_type ___first>
+			static constexpr auto attributes(void) noexcept -> const vk::vertex_input_attribute_description* {
+				return ___descriptions<___make_sequence, ___binding, ___first>::_descriptions;
+			}
+
 			/* print info */
 			auto print_info(void) -> void {
 
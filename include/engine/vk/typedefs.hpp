@@ -33,6 +33,12 @@ namespace vk {
 	/* unsigned integer 32 type */
 	using u32 = ::uint32_t;
 
+	/* unsigned integer 64 type */
+	using u64 = ::uint64_t;
+
+	/* signed integer 32 type */
+	using i32 = ::int32_t;
+
 	/* 32bit float type */
 	using f32 = float;
 
@@ -111,6 +117,12 @@ namespace vk {
 	/* physical device features */
 	using physical_device_features           = ::VkPhysicalDeviceFeatures;
 
+	/* physical device features 2 */
+	using physical_device_features2          = ::VkPhysicalDeviceFeatures2;
+
+	/* physical device vulkan 1.2 features */
+	using physical_device_vulkan12_features  = ::VkPhysicalDeviceVulkan12Features;
+
 
 	// -- logical device ------------------------------------------------------
 
@@ -249,6 +261,18 @@ namespace vk {
 	/* graphics pipeline info */
 	using graphics_pipeline_info             = ::VkGraphicsPipelineCreateInfo;
 
+	/* compute pipeline info */
+	using compute_pipeline_info              = ::VkComputePipelineCreateInfo;
+
+	/* pipeline cache */
+	using pipeline_cache                     = ::VkPipelineCache;
+
+	/* pipeline cache info */
+	using pipeline_cache_info                = ::VkPipelineCacheCreateInfo;
+
+	/* pipeline cache header (version one) */
+	using pipeline_cache_header              = ::VkPipelineCacheHeaderVersionOne;
+
 
 	/* pipeline bind point */
 	using pipeline_bind_point                = ::VkPipelineBindPoint;
@@ -291,6 +315,15 @@ namespace vk {
 	/* pipeline stage flags */
 	using pipeline_stage_flags               = ::VkPipelineStageFlags;
 
+	/* access flags */
+	using access_flags                       = ::VkAccessFlags;
+
+	/* memory barrier */
+	using memory_barrier                     = ::VkMemoryBarrier;
+
+	/* buffer memory barrier */
+	using buffer_memory_barrier              = ::VkBufferMemoryBarrier;
+
 	/* primitive topology */
 	using primitive_topology                  = ::VkPrimitiveTopology;
 
@@ -314,6 +347,15 @@ namespace vk {
 	/* semaphore info */
 	using semaphore_info                     = ::VkSemaphoreCreateInfo;
 
+	/* semaphore type info */
+	using semaphore_type_info                = ::VkSemaphoreTypeCreateInfo;
+
+	/* semaphore wait info */
+	using semaphore_wait_info                = ::VkSemaphoreWaitInfo;
+
+	/* timeline semaphore submit info */
+	using timeline_semaphore_submit_info     = ::VkTimelineSemaphoreSubmitInfo;
+
 
 	// -- fence ---------------------------------------------------------------
 
@@ -356,6 +398,9 @@ namespace vk {
 	/* shader stage flag bits */
 	using shader_stage_flag_bits             = ::VkShaderStageFlagBits;
 
+	/* shader stage flags */
+	using shader_stage_flags                 = ::VkShaderStageFlags;
+
 	/* specialization info */
 	using specialization_info                = ::VkSpecializationInfo;
 
@@ -394,6 +439,9 @@ namespace vk {
 	/* pfn void function */
 	using pfn_void_function                  = ::PFN_vkVoidFunction;
 
+	/* pfn enumerate instance version */
+	using pfn_enumerate_instance_version     = ::PFN_vkEnumerateInstanceVersion;
+
 
 	// -- buffer --------------------------------------------------------------
 
@@ -409,6 +457,9 @@ namespace vk {
 	/* sharing mode */
 	using sharing_mode                       = ::VkSharingMode;
 
+	/* buffer copy */
+	using buffer_copy                        = ::VkBufferCopy;
+
 
 	// -- memory --------------------------------------------------------------
 
@@ -424,9 +475,30 @@ namespace vk {
 	/* memory property flags */
 	using memory_property_flags              = ::VkMemoryPropertyFlags;
 
+	/* memory heap flags */
+	using memory_heap_flags                  = ::VkMemoryHeapFlags;
+
+	/* physical device memory properties 2 */
+	using physical_device_memory_properties2 = ::VkPhysicalDeviceMemoryProperties2;
+
+	/* physical device memory budget properties */
+	using physical_device_memory_budget_properties = ::VkPhysicalDeviceMemoryBudgetPropertiesEXT;
+
 	/* memory allocate info */
 	using memory_allocate_info               = ::VkMemoryAllocateInfo;
 
+	/* buffer memory requirements info 2 */
+	using buffer_memory_requirements_info2   = ::VkBufferMemoryRequirementsInfo2;
+
+	/* memory requirements 2 */
+	using memory_requirements2               = ::VkMemoryRequirements2;
+
+	/* memory dedicated requirements */
+	using memory_dedicated_requirements      = ::VkMemoryDedicatedRequirements;
+
+	/* memory dedicated allocate info */
+	using memory_dedicated_allocate_info     = ::VkMemoryDedicatedAllocateInfo;
+
 	/* memory map flags */
 	using memory_map_flags                   = ::VkMemoryMapFlags;
 
@@ -450,6 +522,18 @@ namespace vk {
 	/* primitive topology */
 	using primitive_topology                 = ::VkPrimitiveTopology;
 
+	/* polygon mode */
+	using polygon_mode                       = ::VkPolygonMode;
+
+	/* cull mode flags */
+	using cull_mode_flags                    = ::VkCullModeFlags;
+
+	/* front face */
+	using front_face                         = ::VkFrontFace;
+
+	/* compare operation */
+	using compare_op                         = ::VkCompareOp;
+
 
 	/* viewport */
 	using viewport                           = ::VkViewport;
@@ -544,6 +628,12 @@ namespace vk {
 	using index_type                         = ::VkIndexType;
 
 
+	// -- indirect ------------------------------------------------------------
+
+	/* draw indexed indirect command */
+	using draw_indexed_indirect_command      = ::VkDrawIndexedIndirectCommand;
+
+
 } // namespace vk
 
 
@@ -591,6 +681,9 @@ namespace vk {
 /* get device queue */
 #define vk_get_device_queue vkGetDeviceQueue
 
+/* queue submit */
+#define vk_queue_submit vkQueueSubmit
+
 
 // -- command pool ------------------------------------------------------------
 
@@ -639,6 +732,18 @@ namespace vk {
 /* cmd draw indexed */
 #define vk_cmd_draw_indexed vkCmdDrawIndexed
 
+/* cmd draw indexed indirect */
+#define vk_cmd_draw_indexed_indirect vkCmdDrawIndexedIndirect
+
+/* cmd draw indexed indirect count (vulkan 1.2) */
+#define vk_cmd_draw_indexed_indirect_count vkCmdDrawIndexedIndirectCount
+
+/* cmd dispatch */
+#define vk_cmd_dispatch vkCmdDispatch
+
+/* cmd fill buffer */
+#define vk_cmd_fill_buffer vkCmdFillBuffer
+
 /* cmd bind pipeline */
 #define vk_cmd_bind_pipeline vkCmdBindPipeline
 
@@ -657,6 +762,15 @@ namespace vk {
 /* cmd set scissor */
 #define vk_cmd_set_scissor vkCmdSetScissor
 
+/* cmd copy buffer */
+#define vk_cmd_copy_buffer vkCmdCopyBuffer
+
+/* cmd pipeline barrier */
+#define vk_cmd_pipeline_barrier vkCmdPipelineBarrier
+
+/* cmd bind descriptor sets */
+#define vk_cmd_bind_descriptor_sets vkCmdBindDescriptorSets
+
 
 // -- render pass -------------------------------------------------------------
 
@@ -681,10 +795,25 @@ namespace vk {
 /* create pipeline */
 #define vk_create_graphics_pipelines vkCreateGraphicsPipelines
 
+/* create compute pipelines */
+#define vk_create_compute_pipelines vkCreateComputePipelines
+
 /* destroy pipeline */
 #define vk_destroy_pipeline vkDestroyPipeline
 
 
+// -- pipeline cache ----------------------------------------------------------
+
+/* create pipeline cache */
+#define vk_create_pipeline_cache vkCreatePipelineCache
+
+/* destroy pipeline cache */
+#define vk_destroy_pipeline_cache vkDestroyPipelineCache
+
+/* get pipeline cache data */
+#define vk_get_pipeline_cache_data vkGetPipelineCacheData
+
+
 // -- pipeline layout ---------------------------------------------------------
 
 /* create pipeline layout */
@@ -729,9 +858,39 @@ namespace vk {
 /* get buffer memory requirements */
 #define vk_get_buffer_memory_requirements vkGetBufferMemoryRequirements
 
+/* get buffer memory requirements 2 */
+#define vk_get_buffer_memory_requirements2 vkGetBufferMemoryRequirements2
+
 /* get physical device memory properties */
 #define vk_get_physical_device_memory_properties vkGetPhysicalDeviceMemoryProperties
 
+/* get physical device memory properties 2 */
+#define vk_get_physical_device_memory_properties2 vkGetPhysicalDeviceMemoryProperties2
+
+/* get physical device features 2 */
+#define vk_get_physical_device_features2 vkGetPhysicalDeviceFeatures2
+
+
+
+// -- descriptor --------------------------------------------------------------
+
+/* create descriptor set layout */
+#define vk_create_descriptor_set_layout vkCreateDescriptorSetLayout
+
+/* destroy descriptor set layout */
+#define vk_destroy_descriptor_set_layout vkDestroyDescriptorSetLayout
+
+/* create descriptor pool */
+#define vk_create_descriptor_pool vkCreateDescriptorPool
+
+/* destroy descriptor pool */
+#define vk_destroy_descriptor_pool vkDestroyDescriptorPool
+
+/* allocate descriptor sets */
+#define vk_allocate_descriptor_sets vkAllocateDescriptorSets
+
+/* update descriptor sets */
+#define vk_update_descriptor_sets vkUpdateDescriptorSets
 
 
 // -- fence -------------------------------------------------------------------
@@ -748,6 +907,9 @@ namespace vk {
 /* wait for fences */
 #define vk_wait_for_fences vkWaitForFences
 
+/* get fence status */
+#define vk_get_fence_status vkGetFenceStatus
+
 
 // -- semaphore ---------------------------------------------------------------
 
@@ -757,6 +919,12 @@ namespace vk {
 /* destroy semaphore */
 #define vk_destroy_semaphore vkDestroySemaphore
 
+/* wait semaphores */
+#define vk_wait_semaphores vkWaitSemaphores
+
+/* get semaphore counter value */
+#define vk_get_semaphore_counter_value vkGetSemaphoreCounterValue
+
 
 /* get physical device format properties */
 #define vk_get_physical_device_format_properties vkGetPhysicalDeviceFormatProperties
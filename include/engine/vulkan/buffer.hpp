@@ -39,6 +39,12 @@ namespace vulkan {
 			/* buffer */
 			vk::buffer _buffer;
 
+			/* size */
+			vk::device_size _size;
+
+			/* usage */
+			vk::buffer_usage_flags _usage;
+
 
 		public:
 
@@ -75,6 +81,18 @@ namespace vulkan {
 			/* underlying */
 			auto underlying(void) const noexcept -> const vk::buffer&;
 
+			/* size */
+			auto size(void) const noexcept -> vk::device_size;
+
+			/* usage */
+			auto usage(void) const noexcept -> vk::buffer_usage_flags;
+
+
+			// -- public modifiers --------------------------------------------
+
+			/* release (caller owns the handle) */
+			auto release(void) noexcept -> vk::buffer;
+
 	}; // class buffer
 
 } // namespace vulkan
@@ -119,6 +119,17 @@ namespace vulkan {
 						cmds.data());
 			}
 
+			/* execute secondary commands (handles from several pools) */
+			auto execute_secondary_commands(const vk::command_buffer* ___cmds, const vk::u32& ___count)
+				const noexcept -> void requires (std::same_as<___type, vulkan::primary>) {
+
+				if (___count == 0U)
+					return;
+
+				// execute secondary command buffers
+				::vk_cmd_execute_commands(_cbuffer, ___count, ___cmds);
+			}
+
 
 			/* begin */
 			auto begin(void) const -> void {
@@ -171,6 +182,37 @@ namespace vulkan {
 						_cbuffer, &info);
 			}
 
+			/* begin (secondary, continues a render pass) */
+			auto begin(const vulkan::render_pass& ___render_pass,
+					   const vk::framebuffer& ___framebuffer) const -> void
+					   requires (std::same_as<___type, vulkan::secondary>) {
+
+				// render pass state executed into
+				const vk::command_buffer_inheritance_info inheritance {
+					.sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+					.pNext                = nullptr,
+					.renderPass           = ___render_pass.underlying(),
+					.subpass              = 0U,
+					.framebuffer          = ___framebuffer,
+					.occlusionQueryEnable = VK_FALSE,
+					.queryFlags           = 0U,
+					.pipelineStatistics   = 0U
+				};
+
+				const vk::command_buffer_begin_info info {
+					.sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+					.pNext            = nullptr,
+					// entirely inside one render pass, replayed by retained primaries
+					.flags            = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+					.pInheritanceInfo = &inheritance
+				};
+
+				// try to begin command buffer
+				vk::try_execute<"failed to begin command buffer">(
+						::vk_begin_command_buffer,
+						_cbuffer, &info);
+			}
+
 			/* end */
 			auto end(void) const -> void {
 
@@ -183,7 +225,8 @@ namespace vulkan {
 			/* begin render pass */
 			auto begin_render_pass(const vulkan::swapchain& swapchain,
 								   const vulkan::render_pass& render_pass,
-								   const vk::framebuffer& framebuffer) const noexcept -> void {
+								   const vk::framebuffer& framebuffer,
+								   const vk::subpass_contents& contents = VK_SUBPASS_CONTENTS_INLINE) const noexcept -> void {
 
 				// clear color
 				const vk::clear_value clear{
@@ -221,8 +264,8 @@ namespace vulkan {
 						_cbuffer,
 						// render pass begin info
 						&info,
-						// subpass contents
-						VK_SUBPASS_CONTENTS_INLINE);
+						// subpass contents (inline or secondary command buffers)
+						contents);
 			}
 
 			/* end render pass */
@@ -322,6 +365,41 @@ namespace vulkan {
 						&___ofs);
 			}
 
+			/* bind vertex buffer (binding 1 for per-instance streams) */
+			auto bind_vertex_buffer(const vk::buffer& buffer,
+									const vk::u32 binding = 0U,
+									const vk::device_size offset = 0U) const noexcept -> void {
+
+				// bind vertex buffers
+				::vk_cmd_bind_vertex_buffers(
+						// command buffer
+						_cbuffer,
+						// first binding
+						binding,
+						// binding count
+						1U,
+						// buffers
+						&buffer,
+						// offsets
+						&offset);
+			}
+
+			/* bind index buffer */
+			auto bind_index_buffer(const vk::buffer& buffer,
+								   const vk::index_type& type) const noexcept -> void {
+
+				// bind index buffer
+				::vk_cmd_bind_index_buffer(
+						// command buffer
+						_cbuffer,
+						// buffer
+						buffer,
+						// offset
+						0U,
+						// index type
+						type);
+			}
+
 			/* bind index buffer */
 			auto bind_index_buffer(const vulkan::index_buffer& ibuffer) const noexcept -> void {
 
@@ -357,7 +435,11 @@ namespace vulkan {
 			}
 
 			/* draw indexed */
-			auto draw_indexed(const vk::u32 index_count) const noexcept -> void {
+			auto draw_indexed(const vk::u32 index_count,
+							  const vk::u32 first_index    = 0U,
+							  const vk::i32 vertex_offset  = 0,
+							  const vk::u32 instance_count = 1U,
+							  const vk::u32 first_instance = 0U) const noexcept -> void {
 
 				// draw indexed
 				::vk_cmd_draw_indexed(
@@ -366,16 +448,117 @@ namespace vulkan {
 						// index count
 						index_count,
 						// instance count
-						1U,
+						instance_count,
 						// first index
-						0U,
-						// vertex offset
-						0U,
-						// first instance
-						0U
+						first_index,
+						// vertex offset (added to each index)
+						vertex_offset,
+						// first instance (offset in per-instance streams)
+						first_instance
 				);
 			}
 
+			/* draw indexed indirect (commands read from buffer) */
+			auto draw_indexed_indirect(const vk::buffer& buffer,
+									   const vk::device_size& offset,
+									   const vk::u32 draw_count) const noexcept -> void {
+
+				::vk_cmd_draw_indexed_indirect(_cbuffer, buffer, offset, draw_count,
+						sizeof(vk::draw_indexed_indirect_command));
+			}
+
+			/* draw indexed indirect count (draw count read from buffer, vulkan 1.2) */
+			auto draw_indexed_indirect_count(const vk::buffer& buffer,
+											 const vk::device_size& offset,
+											 const vk::buffer& count_buffer,
+											 const vk::device_size& count_offset,
+											 const vk::u32 max_draw_count) const noexcept -> void {
+
+				::vk_cmd_draw_indexed_indirect_count(_cbuffer, buffer, offset,
+						count_buffer, count_offset, max_draw_count,
+						sizeof(vk::draw_indexed_indirect_command));
+			}
+
+			/* dispatch */
+			auto dispatch(const vk::u32 x,
+						  const vk::u32 y = 1U,
+						  const vk::u32 z = 1U) const noexcept -> void {
+				::vk_cmd_dispatch(_cbuffer, x, y, z);
+			}
+
+			/* fill buffer */
+			auto fill_buffer(const vk::buffer& buffer,
+							 const vk::device_size& offset,
+							 const vk::device_size& size,
+							 const vk::u32 value) const noexcept -> void {
+				::vk_cmd_fill_buffer(_cbuffer, buffer, offset, size, value);
+			}
+
+			/* copy buffer */
+			auto copy_buffer(const vk::buffer& src,
+							 const vk::buffer& dst,
+							 const vk::buffer_copy& region) const noexcept -> void {
+
+				// copy buffer region
+				::vk_cmd_copy_buffer(
+						// command buffer
+						_cbuffer,
+						// source buffer
+						src,
+						// destination buffer
+						dst,
+						// region count
+						1U,
+						// regions
+						&region);
+			}
+
+			/* memory barrier */
+			auto memory_barrier(const vk::pipeline_stage_flags& src_stage,
+								const vk::pipeline_stage_flags& dst_stage,
+								const vk::access_flags& src_access,
+								const vk::access_flags& dst_access) const noexcept -> void {
+
+				// create barrier
+				const vk::memory_barrier barrier {
+					// type of structure
+					.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+					// pointer to next structure
+					.pNext         = nullptr,
+					// source access mask
+					.srcAccessMask = src_access,
+					// destination access mask
+					.dstAccessMask = dst_access
+				};
+
+				// pipeline barrier
+				::vk_cmd_pipeline_barrier(
+						// command buffer
+						_cbuffer,
+						// source stage mask
+						src_stage,
+						// destination stage mask
+						dst_stage,
+						// dependency flags
+						0U,
+						// memory barriers
+						1U, &barrier,
+						// buffer memory barriers
+						0U, nullptr,
+						// image memory barriers
+						0U, nullptr);
+			}
+
+			/* buffer barrier (queue family ownership transfer when families differ) */
+			auto buffer_barrier(const vk::pipeline_stage_flags& src_stage,
+								const vk::pipeline_stage_flags& dst_stage,
+								const vk::buffer_memory_barrier* barriers,
+								const vk::u32 count) const noexcept -> void {
+
+				::vk_cmd_pipeline_barrier(_cbuffer, src_stage, dst_stage, 0U,
+						0U, nullptr, count, barriers, 0U, nullptr);
+			}
+
 			/* bind pipeline */
 			auto bind_pipeline(const vk::pipeline& pipeline,
 										const vk::pipeline_bind_point& point
@@ -383,6 +566,32 @@ namespace vulkan {
 				::vk_cmd_bind_pipeline(_cbuffer, point, pipeline);
 			}
 
+			/* bind descriptor set (set 0) */
+			auto bind_descriptor_set(const vulkan::pipeline& pipeline,
+									 const vk::descriptor_set& set,
+									 const vk::pipeline_bind_point& point
+									 = VK_PIPELINE_BIND_POINT_GRAPHICS) const noexcept -> void {
+				::vk_cmd_bind_descriptor_sets(_cbuffer, point, pipeline.layout(),
+						0U, 1U, &set, 0U, nullptr);
+			}
+
+			/* bind descriptor set (set 0, raw layout) */
+			auto bind_descriptor_set(const vk::pipeline_layout& layout,
+									 const vk::descriptor_set& set,
+									 const vk::pipeline_bind_point& point) const noexcept -> void {
+				::vk_cmd_bind_descriptor_sets(_cbuffer, point, layout,
+						0U, 1U, &set, 0U, nullptr);
+			}
+
+			/* push constants (raw layout) */
+			template <typename ___constants>
+			auto push_constants(const vk::pipeline_layout& layout,
+								const vk::shader_stage_flags& stages,
+								const ___constants& constants) const noexcept -> void {
+				::vk_cmd_push_constants(_cbuffer, layout, stages, 0U,
+						sizeof(___constants), &constants);
+			}
+
 			/* push constants */
 			template <typename ___constants>
 			auto push_constants(const vulkan::pipeline& pipeline,
@@ -45,9 +45,12 @@ namespace vulkan {
 			/* deleted default constructor */
 			command_pool(void) = delete;
 
-			/* flags constructor */
+			/* flags constructor (graphics family) */
 			command_pool(const vk::command_pool_create_flags& = 0U);
 
+			/* flags / family constructor */
+			command_pool(const vk::command_pool_create_flags&, const vk::u32&);
+
 			/* deleted copy constructor */
 			command_pool(const ___self&) = delete;
 
@@ -42,12 +42,24 @@ namespace vulkan {
 			/* physical device */
 			vulkan::physical_device _pdevice;
 
-			/* queue family */
+			/* queue family (graphics and present) */
 			vk::u32 _family;
 
+			/* transfer queue family (graphics family when none is dedicated) */
+			vk::u32 _transfer_family;
+
 			/* queue priority */
 			float _priority;
 
+			/* memory budget extension enabled */
+			bool _memory_budget;
+
+			/* draw indirect count feature enabled */
+			bool _draw_indirect_count;
+
+			/* timeline semaphore feature enabled */
+			bool _timeline_semaphore;
+
 
 			// -- private static methods --------------------------------------
 
@@ -57,6 +69,9 @@ namespace vulkan {
 			/* pick physical device */
 			static auto _pick_physical_device(const vk::surface&) -> vulkan::physical_device;
 
+			/* supports timeline (vulkan 1.2 device with timeline semaphores) */
+			static auto _supports_timeline(const vulkan::physical_device&) -> bool;
+
 
 			// -- private lifecycle -------------------------------------------
 
@@ -95,6 +110,18 @@ namespace vulkan {
 			/* queue family */
 			static auto family(void) noexcept -> const vk::u32&;
 
+			/* transfer queue family */
+			static auto transfer_family(void) noexcept -> const vk::u32&;
+
+			/* memory budget */
+			static auto memory_budget(void) noexcept -> bool;
+
+			/* draw indirect count (vulkan 1.2) */
+			static auto draw_indirect_count(void) noexcept -> bool;
+
+			/* timeline semaphore (vulkan 1.2) */
+			static auto timeline_semaphore(void) noexcept -> bool;
+
 
 			// -- public static methods ---------------------------------------
 
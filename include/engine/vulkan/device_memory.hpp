@@ -37,6 +37,9 @@ namespace vulkan {
 			/* memory */
 			vk::device_memory _memory;
 
+			/* mapped pointer (whole memory, mapped once) */
+			mutable void* _mapped;
+
 
 		public:
 
@@ -78,31 +81,36 @@ namespace vulkan {
 
 			/* map */
 			template <typename ___type>
-			auto map(const vk::device_size& ___offset = 0U, const vk::device_size& ___size = VK_WHOLE_SIZE) const -> ___type* {
-
-				void* data;
-
-				// map memory
-				vk::try_execute<"failed to map memory">(
-						::vk_map_memory,
-						vulkan::device::logical(),
-						_memory,
-						___offset,
-						___size,
-						0U, // flags (reserved for future use, not implemented yet by the Vulkan API)
-						&data // data pointer to store the mapped memory
-				);
-
-				// return casted data
-				return static_cast<___type*>(data);
+			auto map(const vk::device_size& ___offset = 0U) const -> ___type* {
+
+				// map whole memory on first call only
+				if (_mapped == nullptr)
+					vk::try_execute<"failed to map memory">(
+							::vk_map_memory,
+							vulkan::device::logical(),
+							_memory,
+							0U,
+							VK_WHOLE_SIZE,
+							0U, // flags (reserved for future use, not implemented yet by the Vulkan API)
+							&_mapped // data pointer to store the mapped memory
+					);
+
+				// return casted data at offset
+				return reinterpret_cast<___type*>(static_cast<vk::u8*>(_mapped) + ___offset);
 			}
 
 			/* unmap */
 			auto unmap(void) const noexcept -> void {
 
+				// check if memory is mapped
+				if (_mapped == nullptr)
+					return;
+
 				// unmap memory
 				::vk_unmap_memory(vulkan::device::logical(),
 						_memory);
+
+				_mapped = nullptr;
 			}
 
 			/* flush */
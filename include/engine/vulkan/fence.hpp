@@ -81,6 +81,9 @@ namespace vulkan {
 			/* wait */
 			auto wait(void) -> void;
 
+			/* signaled */
+			auto signaled(void) const -> bool;
+
 	}; // class fence
 
 } // namespace vulkan
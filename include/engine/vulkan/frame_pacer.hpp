@@ -0,0 +1,163 @@
+/*****************************************************************************/
+/*                                                                           */
+/*          ░  ░░░░  ░  ░░░░  ░  ░░░░░░░  ░░░░  ░░      ░░   ░░░  ░          */
+/*          ▒  ▒▒▒▒  ▒  ▒▒▒▒  ▒  ▒▒▒▒▒▒▒  ▒▒▒  ▒▒  ▒▒▒▒  ▒    ▒▒  ▒          */
+/*          ▓▓  ▓▓  ▓▓  ▓▓▓▓  ▓  ▓▓▓▓▓▓▓     ▓▓▓▓  ▓▓▓▓  ▓  ▓  ▓  ▓          */
+/*          ███    ███  ████  █  ███████  ███  ██        █  ██    █          */
+/*          ████  █████      ██        █  ████  █  ████  █  ███   █          */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef ___ENGINE_VULKAN_FRAME_PACER___
+#define ___ENGINE_VULKAN_FRAME_PACER___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vulkan/semaphore.hpp"
+#include "engine/vulkan/timeline.hpp"
+
+#include <vector>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- F R A M E  P A C E R ------------------------------------------------
+
+	class frame_pacer final {
+
+
+		public:
+
+			// -- public constants --------------------------------------------
+
+			/* frame slots (upper bound of frames in flight) */
+			static constexpr vk::u32 max_frames = 4U;
+
+
+			// -- public types ------------------------------------------------
+
+			/* reset hook (context, slot no longer read by the gpu) */
+			using hook_type = void(*)(void*, const vk::u32&);
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::frame_pacer;
+
+
+			/* attached hook */
+			struct ___hook final {
+
+				/* function */
+				hook_type function;
+
+				/* context */
+				void* context;
+
+			}; // struct ___hook
+
+
+			// -- private members ---------------------------------------------
+
+			/* timeline (frame n signals n + 1) */
+			vulkan::timeline _timeline;
+
+			/* image available semaphores (one per slot) */
+			vulkan::semaphore _image_available[max_frames];
+
+			/* render finished semaphores (one per slot) */
+			vulkan::semaphore _render_finished[max_frames];
+
+			/* current frame number */
+			vk::u64 _frame;
+
+			/* frames in flight */
+			vk::u32 _frames;
+
+			/* reset hooks (per frame resources keyed by slot) */
+			std::vector<___hook> _hooks;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* frames in flight constructor */
+			frame_pacer(const vk::u32& = 2U);
+
+			/* deleted copy constructor */
+			frame_pacer(const ___self&) = delete;
+
+			/* deleted move constructor */
+			frame_pacer(___self&&) = delete;
+
+			/* destructor */
+			~frame_pacer(void) noexcept = default;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* wait current frame (frame submitted frames in flight ago, then resets its slot) */
+			auto wait_current_frame(void) const -> void;
+
+			/* wait (any value handed out by value()) */
+			auto wait(const vk::u64&) const -> void;
+
+			/* reached (non-blocking) */
+			auto reached(const vk::u64&) const -> bool;
+
+			/* frames in flight (clamped to [1, max_frames], applies from next wait) */
+			auto frames(const vk::u32&) noexcept -> void;
+
+			/* attach (hook called with the slot after every wait_current_frame) */
+			auto attach(const hook_type&, void*) -> void;
+
+			/* detach (every hook of context) */
+			auto detach(const void*) noexcept -> void;
+
+
+			// -- public accessors --------------------------------------------
+
+			/* frames in flight */
+			auto frames(void) const noexcept -> vk::u32;
+
+			/* current frame (slot index) */
+			auto current_frame(void) const noexcept -> vk::u32;
+
+			/* value (signaled once current frame completes) */
+			auto value(void) const noexcept -> vk::u64;
+
+			/* timeline */
+			auto timeline(void) const noexcept -> const vulkan::timeline&;
+
+			/* image available semaphore */
+			auto image_available(void) const noexcept -> const vk::semaphore&;
+
+			/* render finished semaphore */
+			auto render_finished(void) const noexcept -> const vk::semaphore&;
+
+
+			// -- public operators --------------------------------------------
+
+			/* next frame (once current value has been submitted) */
+			auto operator++(void) noexcept -> void;
+
+	}; // class frame_pacer
+
+} // namespace vulkan
+
+#endif // ___ENGINE_VULKAN_FRAME_PACER___
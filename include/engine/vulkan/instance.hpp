@@ -40,6 +40,9 @@ namespace vulkan {
 			/* instance */
 			vk::instance _instance;
 
+			/* api version (requested, clamped to the loader) */
+			vk::u32 _version;
+
 			/* messenger */
 			#if defined(ENGINE_VL_DEBUG)
 			vk::debug_utils_messenger _messenger;
@@ -51,6 +54,9 @@ namespace vulkan {
 			/* shared */
 			static auto _shared(void) -> ___self&;
 
+			/* loader version */
+			static auto _loader_version(void) -> vk::u32;
+
 			/* extension properties */
 			static auto extension_properties(void) -> vk::vector<vk::extension_properties>;
 
@@ -135,6 +141,9 @@ namespace vulkan {
 			/* physical devices */
 			static auto physical_devices(void) -> const vk::vector<vulkan::physical_device>&;
 
+			/* api version */
+			static auto version(void) -> vk::u32;
+
 	}; // class instance
 
 } // namespace vulkan
@@ -78,9 +78,15 @@ namespace vulkan {
 			/* find queue family */
 			auto find_queue_family(const vk::surface&, const vk::queue_flags_bits) const -> vk::u32;
 
+			/* find dedicated queue family (required flags without excluded flags, ignored if none) */
+			auto find_dedicated_queue_family(const vk::queue_flags, const vk::queue_flags) const -> vk::u32;
+
 			/* supports swapchain */
 			auto supports_swapchain(void) const noexcept -> bool;
 
+			/* supports extension */
+			auto supports_extension(const char*) const -> bool;
+
 			/* have surface formats */
 			auto have_surface_formats(const vk::surface&) const -> bool;
 
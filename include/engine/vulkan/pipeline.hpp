@@ -19,10 +19,12 @@
 #include "engine/vk/array.hpp"
 #include "engine/vulkan/specialization.hpp"
 #include "engine/vulkan/shader_module.hpp"
+#include "engine/vulkan/pipeline_cache.hpp"
 
 #include "engine/shader_library.hpp"
 
 #include <glm/glm.hpp>
+#include <string>
 
 
 // -- V U L K A N  N A M E S P A C E ------------------------------------------
@@ -72,8 +74,8 @@ namespace vulkan {
 				vk::try_execute<"failed to create graphics pipelines">(
 					::vk_create_graphics_pipelines,
 					vulkan::device::logical(),
-					// pipeline cache
-					VK_NULL_HANDLE,
+					// pipeline cache (shared, persisted across runs)
+					vulkan::pipeline_cache::underlying(),
 					// pipeline count
 					1U,
 					// pipeline info
@@ -156,6 +158,48 @@ namespace vulkan {
 
 
 
+	// -- P I P E L I N E  S T A T E -----------------------------------------
+
+	/* pipeline state (everything the builder varies, defaults match basic) */
+	struct pipeline_state final {
+
+		/* vertex shader name */
+		std::string vertex{"basic"};
+
+		/* fragment shader name */
+		std::string fragment{"basic"};
+
+		/* fragment specialization (optional, must outlive the build) */
+		const vk::specialization_info* specialization{nullptr};
+
+		/* primitive topology */
+		vk::primitive_topology topology{VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST};
+
+		/* polygon mode */
+		vk::polygon_mode polygon{VK_POLYGON_MODE_LINE};
+
+		/* cull mode */
+		vk::cull_mode_flags cull{VK_CULL_MODE_BACK_BIT};
+
+		/* front face */
+		vk::front_face front{VK_FRONT_FACE_CLOCKWISE};
+
+		/* depth test enable */
+		vk::bool32 depth_test{VK_TRUE};
+
+		/* depth write enable */
+		vk::bool32 depth_write{VK_TRUE};
+
+		/* depth compare operation */
+		vk::compare_op depth_compare{VK_COMPARE_OP_LESS};
+
+		/* blend enable (alpha blending over destination) */
+		vk::bool32 blend{VK_FALSE};
+
+	}; // struct pipeline_state
+
+
+
 	// another approach (builder pattern)
 
 	template <typename ___vtype>
@@ -179,19 +223,26 @@ namespace vulkan {
 
 			/* build */
 			static auto build(const engine::shader_library& ___shaders,
-							  const vk::render_pass& ___render_pass) -> vulkan::pipeline {
+							  const vk::render_pass& ___render_pass,
+							  const vk::descriptor_set_layout& ___set_layout = VK_NULL_HANDLE,
+							  const vulkan::pipeline_state& ___state = {}) -> vulkan::pipeline {
+
+				// fragment stage
+				auto fragment = ___shaders.fragment_module(___state.fragment).stage_info();
+				fragment.pSpecializationInfo = ___state.specialization;
 
 				// shader stages
 				const vk::array stages {
-					___shaders.vertex_module("basic").stage_info(),
-					___shaders.fragment_module("basic").stage_info(/* specialization */)
+					___shaders.vertex_module(___state.vertex).stage_info(),
+					fragment
 				};
 
 				// vertex input info
 				const auto vertex_input_info = ___vertex::info();
 
 				// input assembly info
-				const auto input_assembly_info = ___self::input_assembly_info<VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, VK_FALSE>();
+				auto input_assembly_info = ___self::input_assembly_info<VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, VK_FALSE>();
+				input_assembly_info.topology = ___state.topology;
 
 				// tesselation info
 				const auto tesselation_info = ___self::tesselation_info(); 
@@ -206,16 +257,29 @@ namespace vulkan {
 				const auto viewport_info = ___self::viewport_info();
 
 				// rasterization info
-				const auto rasterization_info = ___self::rasterization_info();
+				auto rasterization_info = ___self::rasterization_info();
+				rasterization_info.polygonMode = ___state.polygon;
+				rasterization_info.cullMode    = ___state.cull;
+				rasterization_info.frontFace   = ___state.front;
 
 				// multisample info
 				const auto multisampling = ___self::multisample_info();
 
 				// depth stencil info
-				const auto depth_stencil_info = ___self::depth_stencil_info();
+				auto depth_stencil_info = ___self::depth_stencil_info();
+				depth_stencil_info.depthTestEnable  = ___state.depth_test;
+				depth_stencil_info.depthWriteEnable = ___state.depth_write;
+				depth_stencil_info.depthCompareOp   = ___state.depth_compare;
 
 				// color blend attachment
-				const auto color_blend_attachment = ___self::color_blend_attachment();
+				auto color_blend_attachment = ___self::color_blend_attachment();
+
+				// straight alpha over destination
+				if (___state.blend == VK_TRUE) {
+					color_blend_attachment.blendEnable         = VK_TRUE;
+					color_blend_attachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+					color_blend_attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+				}
 
 				// color blend info
 				const auto color_blend_info = ___self::color_blend_info(color_blend_attachment);
@@ -224,7 +288,7 @@ namespace vulkan {
 				const auto dynamic_state_info = ___self::dynamic_state_info();
 
 				// pipeline layout
-				const auto layout = ___self::layout();
+				const auto layout = ___self::layout(___set_layout);
 
 				// pipeline info
 				vk::graphics_pipeline_info info {
@@ -525,7 +589,7 @@ namespace vulkan {
 			}
 
 			/* pipeline layout */
-			static auto layout(void) -> vk::pipeline_layout {
+			static auto layout(const vk::descriptor_set_layout& ___set_layout) -> vk::pipeline_layout {
 
 				struct model_matrix_temp {
 					glm::mat4 matrix;
@@ -546,10 +610,10 @@ namespace vulkan {
 					.pNext = nullptr,
 					// flags
 					.flags = 0U,
-					// set layout count
-					.setLayoutCount = 0U,
+					// set layout count (set 0, optional)
+					.setLayoutCount = ___set_layout != VK_NULL_HANDLE ? 1U : 0U,
 					// set layouts
-					.pSetLayouts = nullptr,
+					.pSetLayouts = ___set_layout != VK_NULL_HANDLE ? &___set_layout : nullptr,
 					// push constant range count
 					.pushConstantRangeCount = 1U,
 					// push constant ranges
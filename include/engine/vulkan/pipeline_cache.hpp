@@ -0,0 +1,144 @@
+/*****************************************************************************/
+/*                                                                           */
+/*          ░  ░░░░  ░  ░░░░  ░  ░░░░░░░  ░░░░  ░░      ░░   ░░░  ░          */
+/*          ▒  ▒▒▒▒  ▒  ▒▒▒▒  ▒  ▒▒▒▒▒▒▒  ▒▒▒  ▒▒  ▒▒▒▒  ▒    ▒▒  ▒          */
+/*          ▓▓  ▓▓  ▓▓  ▓▓▓▓  ▓  ▓▓▓▓▓▓▓     ▓▓▓▓  ▓▓▓▓  ▓  ▓  ▓  ▓          */
+/*          ███    ███  ████  █  ███████  ███  ██        █  ██    █          */
+/*          ████  █████      ██        █  ████  █  ████  █  ███   █          */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef ___ENGINE_VULKAN_PIPELINE_CACHE___
+#define ___ENGINE_VULKAN_PIPELINE_CACHE___
+
+#include "engine/vk/typedefs.hpp"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- P I P E L I N E  C A C H E ------------------------------------------
+
+	class pipeline_cache final {
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::pipeline_cache;
+
+
+			/* file header (precedes driver data on disk) */
+			struct ___header final {
+
+				/* magic number */
+				vk::u32 magic;
+
+				/* vendor id */
+				vk::u32 vendor;
+
+				/* device id */
+				vk::u32 device;
+
+				/* driver version */
+				vk::u32 driver;
+
+				/* pipeline cache uuid */
+				vk::u8 uuid[VK_UUID_SIZE];
+
+				/* driver data size */
+				vk::u64 size;
+
+				/* driver data checksum */
+				vk::u64 checksum;
+
+			}; // struct ___header
+
+
+			// -- private members ---------------------------------------------
+
+			/* cache file (per user cache directory) */
+			std::string _path;
+
+			/* pipeline cache */
+			vk::pipeline_cache _cache;
+
+			/* save lock */
+			std::mutex _mutex;
+
+			/* driver data size at last save */
+			::size_t _saved;
+
+
+			// -- private static methods --------------------------------------
+
+			/* shared */
+			static auto _shared(void) -> ___self&;
+
+			/* resolve (cache file path, independent of the working directory) */
+			static auto _resolve(void) -> std::string;
+
+			/* load (validated driver data, empty when missing or stale) */
+			static auto _load(const std::string&) -> std::vector<vk::u8>;
+
+			/* header (of current device) */
+			static auto _header(void) -> ___header;
+
+
+			// -- private lifecycle -------------------------------------------
+
+			/* default constructor */
+			pipeline_cache(void);
+
+			/* deleted copy constructor */
+			pipeline_cache(const ___self&) = delete;
+
+			/* deleted move constructor */
+			pipeline_cache(___self&&) = delete;
+
+			/* destructor (saves to disk) */
+			~pipeline_cache(void) noexcept;
+
+
+			// -- private assignment operators --------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- private methods ---------------------------------------------
+
+			/* write (temp file then rename, caller holds lock) */
+			auto _write(void) -> void;
+
+
+		public:
+
+			// -- public static accessors -------------------------------------
+
+			/* underlying (internally synchronized, safe to share between threads,
+			 * first call creates the cache and may throw) */
+			static auto underlying(void) -> const vk::pipeline_cache&;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* save (skipped when nothing was added since last save) */
+			static auto save(void) -> void;
+
+	}; // class pipeline_cache
+
+} // namespace vulkan
+
+#endif // ___ENGINE_VULKAN_PIPELINE_CACHE___
@@ -18,9 +18,17 @@
 #include <vulkan/vulkan.h>
 
 #include "engine/vk/typedefs.hpp"
+#include "engine/vulkan/pipeline.hpp"
+#include "engine/shader_library.hpp"
 
-//#include <unordered_map>
-//#include <string_view>
+#include "renderx/hash/fnv1a.hpp"
+#include "renderx/vulkan/pipeline_compiler.hpp"
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 
 // -- V U L K A N  N A M E S P A C E ------------------------------------------
@@ -30,37 +38,338 @@ namespace vulkan {
 
 	// -- P I P E L I N E  L I B R A R Y ---------------------------------------
 
-	//class pipeline_library final {
+	class pipeline_library final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* key type */
+			using key_type  = vk::u64;
+
+			/* size type */
+			using size_type = vk::u32;
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::pipeline_library;
+
+			/* builder (pipeline_builder<V>::build of requested vertex type) */
+			using ___builder = auto (*)(const engine::shader_library&,
+										const vk::render_pass&,
+										const vk::descriptor_set_layout&,
+										const vulkan::pipeline_state&) -> vulkan::pipeline;
+
+
+			// -- private constants -------------------------------------------
+
+			enum : vk::u32 {
+				/* compile queued or running */
+				___PENDING___,
+				/* pipeline usable */
+				___READY___,
+				/* compile threw, error kept */
+				___FAILED___,
+				/* no rebuild in progress */
+				___IDLE___
+			};
+
+
+			/* entry */
+			struct ___entry final {
+
+				/* serialized state (compared when hashes match) */
+				std::vector<vk::u8> key;
+
+				/* requested state */
+				vulkan::pipeline_state state;
+
+				/* render pass */
+				vk::render_pass render_pass;
+
+				/* descriptor set layout */
+				vk::descriptor_set_layout set_layout;
+
+				/* builder */
+				___builder build;
+
+				/* shader library */
+				const engine::shader_library* shaders;
+
+				/* pipeline (written once, before status leaves pending) */
+				vulkan::pipeline pipeline;
+
+				/* compile error */
+				std::exception_ptr error;
+
+				/* status */
+				std::atomic<vk::u32> status{___PENDING___};
+
+				/* rebuilt pipeline (swapped in by update) */
+				vulkan::pipeline staged;
+
+				/* rebuild status */
+				std::atomic<vk::u32> staging{___IDLE___};
+
+			}; // struct ___entry
+
+
+			/* retired (replaced pipeline, destroyed once its last frame completed) */
+			struct ___retired final {
+
+				/* pipeline */
+				vulkan::pipeline pipeline;
+
+				/* last timeline value that may reference it */
+				vk::u64 value;
+
+			}; // struct ___retired
+
+
+			/* map type (hash to entries sharing it, addresses are stable) */
+			using ___map = std::unordered_map<key_type, std::vector<std::unique_ptr<___entry>>>;
+
+
+		public:
+
+			// -- public classes ----------------------------------------------
+
+			/* handle (future-like, cheap to copy, valid while the library lives) */
+			class handle final {
+
+
+				private:
+
+					// -- private members -------------------------------------
+
+					/* entry */
+					const ___entry* _entry;
+
+
+				public:
+
+					// -- public lifecycle ------------------------------------
+
+					/* default constructor (empty, never ready) */
+					handle(void) noexcept
+					: _entry{nullptr} {
+					}
+
+					/* entry constructor */
+					explicit handle(const ___entry* ___target) noexcept
+					: _entry{___target} {
+					}
+
+
+					// -- public accessors ------------------------------------
+
+					/* ready (non-blocking) */
+					auto ready(void) const noexcept -> bool {
+						return _entry != nullptr
+							&& _entry->status.load(std::memory_order_acquire) == ___READY___;
+					}
+
+					/* failed (non-blocking) */
+					auto failed(void) const noexcept -> bool {
+						return _entry != nullptr
+							&& _entry->status.load(std::memory_order_acquire) == ___FAILED___;
+					}
+
+					/* pending (non-blocking) */
+					auto pending(void) const noexcept -> bool {
+						return _entry != nullptr
+							&& _entry->status.load(std::memory_order_acquire) == ___PENDING___;
+					}
+
+					/* get (ready handles only) */
+					auto get(void) const noexcept -> const vulkan::pipeline& {
+						return _entry->pipeline;
+					}
+
+
+					// -- public methods --------------------------------------
+
+					/* wait (blocks until compiled, rethrows compile error) */
+					auto wait(void) const -> const vulkan::pipeline& {
+
+						_entry->status.wait(___PENDING___, std::memory_order_acquire);
+
+						if (_entry->status.load(std::memory_order_acquire) == ___FAILED___)
+							std::rethrow_exception(_entry->error);
+
+						return _entry->pipeline;
+					}
+
+			}; // class handle
+
+
+		private:
+
+			// -- private members ---------------------------------------------
+
+			/* shader library */
+			const engine::shader_library& _shaders;
+
+			/* pipelines */
+			___map _map;
+
+			/* fallback (drawn while a variant compiles) */
+			handle _fallback;
+
+			/* replaced pipelines still referenced by pending frames */
+			std::vector<___retired> _retired;
+
+			/* rebuilds not yet swapped in */
+			size_type _rebuilding;
+
+			/* requests served from the library */
+			size_type _hits;
+
+			/* requests that built a pipeline */
+			size_type _misses;
+
+			/* compile service (destroyed first, workers never outlive entries) */
+			vulkan::pipeline_compiler _compiler;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			pipeline_library(void) = delete;
+
+			/* shader library constructor */
+			pipeline_library(const engine::shader_library&);
+
+			/* deleted copy constructor */
+			pipeline_library(const ___self&) = delete;
+
+			/* deleted move constructor */
+			pipeline_library(___self&&) = delete;
+
+			/* destructor */
+			~pipeline_library(void) noexcept = default;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* get (compiled on the calling thread when missing, identical states share one pipeline) */
+			template <typename ___vtype>
+			auto get(const vk::render_pass& ___render_pass,
+					 const vk::descriptor_set_layout& ___set_layout = VK_NULL_HANDLE,
+					 const vulkan::pipeline_state& ___state = {}) -> const vulkan::pipeline& {
+
+				bool missed = false;
+
+				___entry& entry = ___self::_acquire(___render_pass, ___set_layout, ___state,
+													___vtype::info(),
+													&vulkan::pipeline_builder<___vtype>::build,
+													missed);
+
+				if (missed == true)
+					___self::_compile(&entry);
+
+				// may still be compiling from an earlier request
+				return handle{&entry}.wait();
+			}
+
+			/* request (compiled on a worker, never blocks,
+			 * specialization data must outlive the compile) */
+			template <typename ___vtype>
+			auto request(const vk::render_pass& ___render_pass,
+						 const vk::descriptor_set_layout& ___set_layout = VK_NULL_HANDLE,
+						 const vulkan::pipeline_state& ___state = {}) -> handle {
+
+				bool missed = false;
+
+				___entry& entry = ___self::_acquire(___render_pass, ___set_layout, ___state,
+													___vtype::info(),
+													&vulkan::pipeline_builder<___vtype>::build,
+													missed);
+
+				if (missed == true)
+					_compiler.submit(&___self::_compile, &entry);
+
+				return handle{&entry};
+			}
+
+			/* fallback (designate pipeline drawn in place of pending ones) */
+			auto fallback(const handle&) noexcept -> void;
+
+			/* resolve (requested pipeline, fallback while pending, null to skip the draw) */
+			auto resolve(const handle&) const noexcept -> const vulkan::pipeline*;
+
+			/* rebuild (recompile pipelines using a reloaded module in the background,
+			 * current pipelines stay bound until update swaps them) */
+			auto rebuild(const vk::shader_stage_flag_bits, const std::string&) -> size_type;
+
+			/* update (swap rebuilt pipelines, destroy retired ones,
+			 * submitted: last value that may use current pipelines, completed: reached value)
+			 * returns true when recorded command buffers must be recorded again */
+			auto update(const vk::u64&, const vk::u64&) -> bool;
+
+			/* drain (wait for queued compiles, before modules are replaced) */
+			auto drain(void) -> void;
+
+			/* clear (waits for compiles, pipelines must not be in use) */
+			auto clear(void) -> void;
 
 
-	//	public:
+			// -- public accessors --------------------------------------------
 
-	//		// -- public types ------------------------------------------------
+			/* hits */
+			auto hits(void) const noexcept -> size_type;
 
-	//		/* self type */
-	//		using self = vulkan::pipeline_library;
+			/* misses */
+			auto misses(void) const noexcept -> size_type;
 
+			/* size (distinct pipelines) */
+			auto size(void) const noexcept -> size_type;
 
-	//		// -- public lifecycle --------------------------------------------
 
-	//		/* default constructor */
-	//		pipeline_library(void);
+		private:
 
+			// -- private methods ---------------------------------------------
 
-	//	private:
+			/* serialize (every input of the pipeline) */
+			auto _serialize(const vk::render_pass&,
+							const vk::descriptor_set_layout&,
+							const vulkan::pipeline_state&,
+							const vk::pipeline_vertex_input_state_info&) const -> std::vector<vk::u8>;
 
-	//		// -- private types -----------------------------------------------
+			/* acquire (existing entry, or a new pending one when missed) */
+			auto _acquire(const vk::render_pass&,
+						  const vk::descriptor_set_layout&,
+						  const vulkan::pipeline_state&,
+						  const vk::pipeline_vertex_input_state_info&,
+						  const ___builder,
+						  bool&) -> ___entry&;
 
-	//		/* map type */
-	//		using map_type = std::unordered_map<std::string_view, vk::pipeline>;
 
+			// -- private static methods --------------------------------------
 
-	//		// -- private members ---------------------------------------------
+			/* compile (entry context, any thread) */
+			static auto _compile(void*) noexcept -> void;
 
-	//		/* map */
-	//		map_type _map;
+			/* restage (entry context, any thread, rebuilds into staged) */
+			static auto _restage(void*) noexcept -> void;
 
-	//}; // class pipeline_library
+	}; // class pipeline_library
 
 } // namespace vulkan
 
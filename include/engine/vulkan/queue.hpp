@@ -15,6 +15,8 @@
 #include "engine/vulkan/commands.hpp"
 #include "engine/vulkan/swapchain.hpp"
 #include "engine/vulkan/fence.hpp"
+#include "engine/vulkan/timeline.hpp"
+#include "engine/vulkan/submission.hpp"
 
 
 // -- V U L K A N -------------------------------------------------------------
@@ -40,14 +42,26 @@ namespace vulkan {
 			/* queue */
 			vk::queue _queue;
 
+			/* queue family */
+			vk::u32 _family;
+
 
 		public:
 
 			// -- public lifecycle --------------------------------------------
 
-			/* default constructor */
+			/* default constructor (graphics family) */
 			queue(void) noexcept;
 
+			/* family constructor (first queue of family) */
+			queue(const vk::u32&) noexcept;
+
+
+			// -- public accessors --------------------------------------------
+
+			/* family */
+			auto family(void) const noexcept -> const vk::u32&;
+
 
 			// -- public static methods ---------------------------------------
 
@@ -57,10 +71,26 @@ namespace vulkan {
 
 			// -- public methods ----------------------------------------------
 
-			auto submit(const vk::semaphore& wait,
-						const vk::semaphore& signal,
-						const vk::fence& fence,
-						const vulkan::command_buffer<vulkan::primary>&) const -> void;
+			/* submit (no semaphores) */
+			auto submit(const vulkan::command_buffer<vulkan::primary>&,
+						const vk::fence&) const -> void;
+
+			/* submit (timeline signals value, no binary semaphores) */
+			auto submit(const vulkan::command_buffer<vulkan::primary>&,
+						const vulkan::timeline&,
+						const vk::u64&) const -> void;
+
+			/* submit (waits a timeline value at stage, then signals a timeline value) */
+			auto submit(const vulkan::command_buffer<vulkan::primary>&,
+						const vulkan::timeline& wait,
+						const vk::u64&,
+						const vk::pipeline_stage_flags&,
+						const vulkan::timeline& signal,
+						const vk::u64&) const -> void;
+
+			/* submit (every batch in a single vkQueueSubmit) */
+			auto submit(vulkan::submission&,
+						const vk::fence& = VK_NULL_HANDLE) const -> void;
 
 			/* present */
 			auto present(const vulkan::swapchain&,
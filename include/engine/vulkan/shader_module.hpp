@@ -25,39 +25,105 @@
 #include <xns/string_literal.hpp>
 #include <xns/unique_descriptor.hpp>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 
 
 
-inline auto get_file_content(const xns::string_view& path) -> xns::vector<char> {
+// -- V U L K A N -------------------------------------------------------------
 
-	xns::unique_descriptor file{::open(path.data(), O_RDONLY)};
+namespace vulkan {
 
-	if (not file)
-		throw vk::exception{"failed to open shader file"};
 
-	struct stat stat;
-	if (::fstat(file, &stat) == -1)
-		throw vk::exception{"failed to open shader file"};
+	// -- S P I R V  F I L E --------------------------------------------------
 
-	const vk::u32 size = static_cast<vk::u32>(stat.st_size);
+	class spirv_file final {
 
-	xns::vector<char> buffer;
-	buffer.resize(size);
 
+		private:
 
-	const auto readed = ::read(file, buffer.data(), size);
+			// -- private types -----------------------------------------------
 
-	if (readed != size)
-		throw vk::exception{"failed to read shader file"};
+			/* self type */
+			using ___self = vulkan::spirv_file;
 
-	return buffer;
-}
 
+			// -- private members ---------------------------------------------
 
+			/* mapped code (read only, pages faulted in by the driver) */
+			void* _data;
 
-// -- V U L K A N -------------------------------------------------------------
+			/* size in bytes */
+			::size_t _size;
 
-namespace vulkan {
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			spirv_file(void) = delete;
+
+			/* path constructor */
+			spirv_file(const xns::string& ___path)
+			: _data{MAP_FAILED}, _size{0U} {
+
+				xns::unique_descriptor file{::open(___path.data(), O_RDONLY)};
+
+				if (not file)
+					throw vk::exception{"failed to open shader file"};
+
+				struct stat stat;
+				if (::fstat(file, &stat) == -1)
+					throw vk::exception{"failed to open shader file"};
+
+				_size = static_cast<::size_t>(stat.st_size);
+
+				// spirv is a stream of 32-bit words
+				if (_size == 0U || (_size % sizeof(vk::u32)) != 0U)
+					throw vk::exception{"invalid shader file size"};
+
+				// mapping outlives the descriptor
+				_data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file, 0);
+
+				if (_data == MAP_FAILED)
+					throw vk::exception{"failed to map shader file"};
+			}
+
+			/* deleted copy constructor */
+			spirv_file(const ___self&) = delete;
+
+			/* deleted move constructor */
+			spirv_file(___self&&) = delete;
+
+			/* destructor */
+			~spirv_file(void) noexcept {
+				::munmap(_data, _size);
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public accessors --------------------------------------------
+
+			/* code (page aligned, suitable for pCode) */
+			auto code(void) const noexcept -> const vk::u32* {
+				return static_cast<const vk::u32*>(_data);
+			}
+
+			/* size (bytes) */
+			auto size(void) const noexcept -> ::size_t {
+				return _size;
+			}
+
+	}; // class spirv_file
 
 
 	// -- S H A D E R  M O D U L E --------------------------------------------
@@ -93,8 +159,8 @@ namespace vulkan {
 			shader_module(const xns::string& ___path)
 			/* uninitialized module */ {
 
-				// get shader data
-				const auto data = get_file_content(___path);
+				// map shader code (unmapped once the module is created)
+				const vulkan::spirv_file data{___path};
 
 				// create info
 				vk::shader_module_info info {
@@ -107,7 +173,7 @@ namespace vulkan {
 					// data size
 					.codeSize = data.size(),
 					// data pointer
-					.pCode    = reinterpret_cast<const vk::u32*>(data.data())
+					.pCode    = data.code()
 				};
 
 				// create shader module
@@ -0,0 +1,174 @@
+/*****************************************************************************/
+/*                                                                           */
+/*          ░  ░░░░  ░  ░░░░  ░  ░░░░░░░  ░░░░  ░░      ░░   ░░░  ░          */
+/*          ▒  ▒▒▒▒  ▒  ▒▒▒▒  ▒  ▒▒▒▒▒▒▒  ▒▒▒  ▒▒  ▒▒▒▒  ▒    ▒▒  ▒          */
+/*          ▓▓  ▓▓  ▓▓  ▓▓▓▓  ▓  ▓▓▓▓▓▓▓     ▓▓▓▓  ▓▓▓▓  ▓  ▓  ▓  ▓          */
+/*          ███    ███  ████  █  ███████  ███  ██        █  ██    █          */
+/*          ████  █████      ██        █  ████  █  ████  █  ███   █          */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef ___ENGINE_VULKAN_SUBMISSION___
+#define ___ENGINE_VULKAN_SUBMISSION___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vulkan/command_buffer.hpp"
+#include "engine/vulkan/timeline.hpp"
+
+#include <vector>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- S U B M I S S I O N -------------------------------------------------
+
+	class submission final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* size type */
+			using size_type = vk::u32;
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::submission;
+
+
+			/* batch (ranges in the flat arrays) */
+			struct ___batch final {
+
+				/* first wait */
+				size_type wait_first;
+
+				/* wait count */
+				size_type wait_count;
+
+				/* first command buffer */
+				size_type cmd_first;
+
+				/* command buffer count */
+				size_type cmd_count;
+
+				/* first signal */
+				size_type signal_first;
+
+				/* signal count */
+				size_type signal_count;
+
+			}; // struct ___batch
+
+
+			// -- private members ---------------------------------------------
+
+			/* wait semaphores */
+			std::vector<vk::semaphore> _waits;
+
+			/* wait values (ignored for binary semaphores) */
+			std::vector<vk::u64> _wait_values;
+
+			/* wait stages */
+			std::vector<vk::pipeline_stage_flags> _wait_stages;
+
+			/* command buffers */
+			std::vector<vk::command_buffer> _cmds;
+
+			/* signal semaphores */
+			std::vector<vk::semaphore> _signals;
+
+			/* signal values (ignored for binary semaphores) */
+			std::vector<vk::u64> _signal_values;
+
+			/* batches (last one is open) */
+			std::vector<___batch> _batches;
+
+			/* timeline infos (built on flush) */
+			std::vector<vk::timeline_semaphore_submit_info> _timelines;
+
+			/* submit infos (built on flush) */
+			std::vector<vk::submit_info> _infos;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor */
+			submission(void);
+
+			/* deleted copy constructor */
+			submission(const ___self&) = delete;
+
+			/* move constructor */
+			submission(___self&&) noexcept = default;
+
+			/* destructor */
+			~submission(void) noexcept = default;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* move assignment operator */
+			auto operator=(___self&&) noexcept -> ___self& = default;
+
+
+			// -- public modifiers --------------------------------------------
+
+			/* wait (binary semaphore) */
+			auto wait(const vk::semaphore&, const vk::pipeline_stage_flags&) -> ___self&;
+
+			/* wait (timeline value) */
+			auto wait(const vulkan::timeline&, const vk::u64&, const vk::pipeline_stage_flags&) -> ___self&;
+
+			/* execute */
+			auto execute(const vulkan::command_buffer<vulkan::primary>&) -> ___self&;
+
+			/* signal (binary semaphore) */
+			auto signal(const vk::semaphore&) -> ___self&;
+
+			/* signal (timeline value) */
+			auto signal(const vulkan::timeline&, const vk::u64&) -> ___self&;
+
+			/* next (close current batch, following calls fill a new one) */
+			auto next(void) -> ___self&;
+
+			/* clear (storage is kept for the next frame) */
+			auto clear(void) noexcept -> void;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* build (submit infos of non empty batches, valid until next modification) */
+			auto build(void) -> const std::vector<vk::submit_info>&;
+
+
+			// -- public accessors --------------------------------------------
+
+			/* empty */
+			auto empty(void) const noexcept -> bool;
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* current batch */
+			auto _current(void) noexcept -> ___batch&;
+
+	}; // class submission
+
+} // namespace vulkan
+
+#endif // ___ENGINE_VULKAN_SUBMISSION___
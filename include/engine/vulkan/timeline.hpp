@@ -0,0 +1,88 @@
+/*****************************************************************************/
+/*                                                                           */
+/*          ░  ░░░░  ░  ░░░░  ░  ░░░░░░░  ░░░░  ░░      ░░   ░░░  ░          */
+/*          ▒  ▒▒▒▒  ▒  ▒▒▒▒  ▒  ▒▒▒▒▒▒▒  ▒▒▒  ▒▒  ▒▒▒▒  ▒    ▒▒  ▒          */
+/*          ▓▓  ▓▓  ▓▓  ▓▓▓▓  ▓  ▓▓▓▓▓▓▓     ▓▓▓▓  ▓▓▓▓  ▓  ▓  ▓  ▓          */
+/*          ███    ███  ████  █  ███████  ███  ██        █  ██    █          */
+/*          ████  █████      ██        █  ████  █  ████  █  ███   █          */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifndef ___ENGINE_VULKAN_TIMELINE___
+#define ___ENGINE_VULKAN_TIMELINE___
+
+#include "engine/vk/typedefs.hpp"
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- T I M E L I N E -----------------------------------------------------
+
+	class timeline final {
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::timeline;
+
+
+			// -- private members ---------------------------------------------
+
+			/* timeline semaphore */
+			vk::semaphore _semaphore;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* initial value constructor (requires vulkan 1.2 timeline semaphores) */
+			timeline(const vk::u64& = 0U);
+
+			/* deleted copy constructor */
+			timeline(const ___self&) = delete;
+
+			/* move constructor */
+			timeline(___self&&) noexcept;
+
+			/* destructor */
+			~timeline(void) noexcept;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* move assignment operator */
+			auto operator=(___self&&) noexcept -> ___self&;
+
+
+			// -- public accessors --------------------------------------------
+
+			/* underlying */
+			auto underlying(void) const noexcept -> const vk::semaphore&;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* wait (until counter reaches value) */
+			auto wait(const vk::u64&) const -> void;
+
+			/* completed (current counter value, non-blocking) */
+			auto completed(void) const -> vk::u64;
+
+			/* reached (non-blocking) */
+			auto reached(const vk::u64&) const -> bool;
+
+	}; // class timeline
+
+} // namespace vulkan
+
+#endif // ___ENGINE_VULKAN_TIMELINE___
@@ -0,0 +1,31 @@
+#ifndef ___RENDERX_HASH_FNV1A___
+#define ___RENDERX_HASH_FNV1A___
+
+#include <cstddef>
+#include "engine/types.hpp"
+
+
+// -- R X  N A M E S P A C E --------------------------------------------------
+
+namespace rx {
+
+	/* fnv-1a offset basis */
+	inline constexpr rx::u64 fnv1a_basis = 0xCBF29CE484222325U;
+
+	/* fnv-1a (64 bit, chained through seed) */
+	inline auto fnv1a(const void* ___data, const rx::size_t ___size,
+					  rx::u64 ___seed = rx::fnv1a_basis) noexcept -> rx::u64 {
+
+		const auto* bytes = static_cast<const rx::u8*>(___data);
+
+		for (rx::size_t i = 0U; i < ___size; ++i) {
+			___seed ^= bytes[i];
+			___seed *= 0x100000001B3U;
+		}
+
+		return ___seed;
+	}
+
+} // namespace rx
+
+#endif // ___RENDERX_HASH_FNV1A___
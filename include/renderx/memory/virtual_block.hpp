@@ -0,0 +1,565 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_MEMORY_VIRTUAL_BLOCK___
+#define ___RENDERX_MEMORY_VIRTUAL_BLOCK___
+
+#include "engine/types.hpp"
+
+#include <vector>
+
+
+// -- R X  N A M E S P A C E --------------------------------------------------
+
+namespace rx {
+
+
+	// -- V I R T U A L  B L O C K --------------------------------------------
+
+	class virtual_block final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* size type */
+			using size_type = rx::u64;
+
+			/* node type */
+			using node_type = rx::u32;
+
+
+			// -- public constants --------------------------------------------
+
+			/* null node */
+			enum : node_type {
+				NIL = ~0U
+			};
+
+
+			// -- public structs ----------------------------------------------
+
+			/* range */
+			struct range final {
+
+				/* offset */
+				size_type offset;
+
+				/* node */
+				node_type node;
+
+			}; // struct range
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = rx::virtual_block;
+
+
+			// -- private constants -------------------------------------------
+
+			/* two level segregated fit parameters
+			 * first level:  power of two classes
+			 * second level: linear subdivision of each class */
+			enum : rx::u32 {
+				/* second level count log2 */
+				___SL_LOG2___   = 5U,
+				/* second level count */
+				___SL_COUNT___  = 1U << ___SL_LOG2___,
+				/* minimum granularity log2 */
+				___ALIGN_LOG2___ = 3U,
+				/* first level shift */
+				___FL_SHIFT___  = ___SL_LOG2___ + ___ALIGN_LOG2___,
+				/* first level max (1 TiB) */
+				___FL_MAX___    = 40U,
+				/* first level count */
+				___FL_COUNT___  = ___FL_MAX___ - ___FL_SHIFT___ + 1U,
+				/* small block size */
+				___SMALL___     = 1U << ___FL_SHIFT___
+			};
+
+
+			// -- private structs ---------------------------------------------
+
+			/* node */
+			struct ___node final {
+
+				/* offset */
+				size_type offset;
+
+				/* size */
+				size_type size;
+
+				/* previous physical node */
+				node_type prev_phys;
+
+				/* next physical node */
+				node_type next_phys;
+
+				/* previous free node */
+				node_type prev_free;
+
+				/* next free node */
+				node_type next_free;
+
+				/* is free */
+				bool free;
+
+			}; // struct ___node
+
+
+			// -- private members ---------------------------------------------
+
+			/* size */
+			size_type _size;
+
+			/* nodes */
+			std::vector<___node> _nodes;
+
+			/* recycled nodes */
+			std::vector<node_type> _recycled;
+
+			/* first level bitmap */
+			rx::u64 _fl_bitmap;
+
+			/* second level bitmaps */
+			rx::u32 _sl_bitmap[___FL_COUNT___];
+
+			/* free list heads */
+			node_type _heads[___FL_COUNT___][___SL_COUNT___];
+
+			/* used bytes */
+			size_type _used;
+
+			/* allocation count */
+			rx::u32 _count;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			virtual_block(void) = delete;
+
+			/* size constructor */
+			explicit virtual_block(const size_type& ___size)
+			: _size{___size}, _nodes{}, _recycled{}, _fl_bitmap{0U},
+			  _sl_bitmap{}, _heads{}, _used{0U}, _count{0U} {
+
+				// whole block is a single free node
+				___self::_init();
+			}
+
+			/* copy constructor */
+			virtual_block(const ___self&) = default;
+
+			/* move constructor */
+			virtual_block(___self&&) noexcept = default;
+
+			/* destructor */
+			~virtual_block(void) noexcept = default;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = default;
+
+			/* move assignment operator */
+			auto operator=(___self&&) noexcept -> ___self& = default;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* allocate */
+			auto allocate(const size_type& ___sz, const size_type& ___align, range& ___rg) -> bool {
+
+				// worst case padding to satisfy alignment
+				const size_type request = ___sz + (___align > 1U ? ___align - 1U : 0U);
+
+				// find a free node large enough (O(1))
+				node_type n = ___self::_find(request);
+
+				if (n == NIL)
+					return false;
+
+				// remove from free list
+				___self::_remove(n);
+
+				// aligned offset
+				const size_type aligned = (_nodes[n].offset + ___align - 1U) & ~(___align - 1U);
+
+				// split front padding, allocation continues in the second part
+				if (const size_type pad = aligned - _nodes[n].offset; pad != 0U) {
+
+					const node_type rest = ___self::_split(n, pad);
+
+					___self::_insert(n);
+
+					n = rest;
+				}
+
+				// split back remainder
+				if (_nodes[n].size > ___sz)
+					___self::_insert(___self::_split(n, ___sz));
+
+				_nodes[n].free = false;
+
+				_used += _nodes[n].size;
+				++_count;
+
+				___rg.offset = _nodes[n].offset;
+				___rg.node   = n;
+
+				return true;
+			}
+
+			/* free */
+			auto free(node_type ___n) -> void {
+
+				___node& node = _nodes[___n];
+
+				_used -= node.size;
+				--_count;
+
+				node.free = true;
+
+				// merge with previous physical node
+				if (const node_type prev = node.prev_phys; prev != NIL && _nodes[prev].free) {
+					___self::_remove(prev);
+					___n = ___self::_merge(prev, ___n);
+				}
+
+				// merge with next physical node
+				if (const node_type next = _nodes[___n].next_phys; next != NIL && _nodes[next].free) {
+					___self::_remove(next);
+					___n = ___self::_merge(___n, next);
+				}
+
+				___self::_insert(___n);
+			}
+
+			/* grow (appended bytes join the last range when it is free) */
+			auto grow(const size_type& ___size) -> void {
+
+				if (___size <= _size)
+					return;
+
+				const size_type extra = ___size - _size;
+
+				// first node is never absorbed, walk to the last one
+				node_type last = 0U;
+
+				while (_nodes[last].next_phys != NIL)
+					last = _nodes[last].next_phys;
+
+				if (_nodes[last].free == true) {
+					___self::_remove(last);
+					_nodes[last].size += extra;
+					___self::_insert(last);
+				}
+				else {
+					const node_type n = ___self::_new_node();
+
+					_nodes[n] = ___node{_size, extra, last, NIL, NIL, NIL, true};
+					_nodes[last].next_phys = n;
+
+					___self::_insert(n);
+				}
+
+				_size = ___size;
+			}
+
+			/* reset */
+			auto reset(void) -> void {
+
+				_nodes.clear();
+				_recycled.clear();
+
+				___self::_init();
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* size */
+			auto size(void) const noexcept -> size_type {
+				return _size;
+			}
+
+			/* used */
+			auto used(void) const noexcept -> size_type {
+				return _used;
+			}
+
+			/* available bytes (not necessarily contiguous) */
+			auto available(void) const noexcept -> size_type {
+				return _size - _used;
+			}
+
+			/* count */
+			auto count(void) const noexcept -> rx::u32 {
+				return _count;
+			}
+
+			/* largest free range */
+			auto largest_free(void) const noexcept -> size_type {
+
+				if (_fl_bitmap == 0U)
+					return 0U;
+
+				// highest non-empty class holds the largest node
+				const auto fl = static_cast<rx::u32>(63 - __builtin_clzll(_fl_bitmap));
+				const auto sl = static_cast<rx::u32>(31 - __builtin_clz(_sl_bitmap[fl]));
+
+				size_type largest = 0U;
+
+				for (node_type n = _heads[fl][sl]; n != NIL; n = _nodes[n].next_free) {
+					if (_nodes[n].size > largest)
+						largest = _nodes[n].size;
+				}
+
+				return largest;
+			}
+
+			/* empty */
+			auto empty(void) const noexcept -> bool {
+				return _count == 0U;
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* init */
+			auto _init(void) -> void {
+
+				_fl_bitmap = 0U;
+				_used      = 0U;
+				_count     = 0U;
+
+				for (rx::u32 fl = 0U; fl < ___FL_COUNT___; ++fl) {
+					_sl_bitmap[fl] = 0U;
+					for (rx::u32 sl = 0U; sl < ___SL_COUNT___; ++sl)
+						_heads[fl][sl] = NIL;
+				}
+
+				const node_type n = ___self::_new_node();
+
+				_nodes[n] = ___node{0U, _size, NIL, NIL, NIL, NIL, true};
+
+				___self::_insert(n);
+			}
+
+			/* new node */
+			auto _new_node(void) -> node_type {
+
+				if (not _recycled.empty()) {
+					const node_type n = _recycled.back();
+					_recycled.pop_back();
+					return n;
+				}
+
+				_nodes.emplace_back();
+				return static_cast<node_type>(_nodes.size() - 1U);
+			}
+
+			/* split (___n keeps the first ___sz bytes, returns the second part) */
+			auto _split(const node_type ___n, const size_type& ___sz) -> node_type {
+
+				// create node for the second part
+				const node_type r = ___self::_new_node();
+
+				___node& node = _nodes[___n];
+				___node& rest = _nodes[r];
+
+				rest.offset    = node.offset + ___sz;
+				rest.size      = node.size - ___sz;
+				rest.prev_phys = ___n;
+				rest.next_phys = node.next_phys;
+				rest.prev_free = NIL;
+				rest.next_free = NIL;
+				rest.free      = true;
+
+				if (node.next_phys != NIL)
+					_nodes[node.next_phys].prev_phys = r;
+
+				node.size      = ___sz;
+				node.next_phys = r;
+
+				return r;
+			}
+
+			/* merge (___b is absorbed into ___a) */
+			auto _merge(const node_type ___a, const node_type ___b) -> node_type {
+
+				___node& a = _nodes[___a];
+				___node& b = _nodes[___b];
+
+				a.size     += b.size;
+				a.next_phys = b.next_phys;
+
+				if (b.next_phys != NIL)
+					_nodes[b.next_phys].prev_phys = ___a;
+
+				// recycle absorbed node
+				_recycled.push_back(___b);
+
+				return ___a;
+			}
+
+			/* insert in free list */
+			auto _insert(const node_type ___n) noexcept -> void {
+
+				rx::u32 fl, sl;
+				___self::_mapping(_nodes[___n].size, fl, sl);
+
+				___node& node = _nodes[___n];
+
+				const node_type head = _heads[fl][sl];
+
+				node.prev_free = NIL;
+				node.next_free = head;
+
+				if (head != NIL)
+					_nodes[head].prev_free = ___n;
+
+				_heads[fl][sl] = ___n;
+
+				_fl_bitmap    |= (rx::u64{1U} << fl);
+				_sl_bitmap[fl] |= (1U << sl);
+			}
+
+			/* remove from free list */
+			auto _remove(const node_type ___n) noexcept -> void {
+
+				rx::u32 fl, sl;
+				___self::_mapping(_nodes[___n].size, fl, sl);
+
+				___node& node = _nodes[___n];
+
+				if (node.prev_free != NIL)
+					_nodes[node.prev_free].next_free = node.next_free;
+
+				if (node.next_free != NIL)
+					_nodes[node.next_free].prev_free = node.prev_free;
+
+				// update head and bitmaps
+				if (_heads[fl][sl] == ___n) {
+
+					_heads[fl][sl] = node.next_free;
+
+					if (node.next_free == NIL) {
+
+						_sl_bitmap[fl] &= ~(1U << sl);
+
+						if (_sl_bitmap[fl] == 0U)
+							_fl_bitmap &= ~(rx::u64{1U} << fl);
+					}
+				}
+
+				node.prev_free = NIL;
+				node.next_free = NIL;
+			}
+
+			/* find */
+			auto _find(const size_type& ___sz) const noexcept -> node_type {
+
+				const node_type n = ___self::_find_class(___sz);
+
+				if (n != NIL)
+					return n;
+
+				rx::u32 fl, sl;
+				___self::_mapping(___sz, fl, sl);
+
+				if (fl >= ___FL_COUNT___)
+					return NIL;
+
+				// exact class may still hold a fit (whole block requests)
+				for (node_type i = _heads[fl][sl]; i != NIL; i = _nodes[i].next_free) {
+					if (_nodes[i].size >= ___sz)
+						return i;
+				}
+
+				return NIL;
+			}
+
+			/* find class (first node of a class where every node fits) */
+			auto _find_class(size_type ___sz) const noexcept -> node_type {
+
+				// round up to the next class, every node found is large enough
+				if (___sz < ___SMALL___)
+					___sz = (___sz + (___SMALL___ / ___SL_COUNT___) - 1U)
+						  & ~static_cast<size_type>((___SMALL___ / ___SL_COUNT___) - 1U);
+				else
+					___sz += (size_type{1U} << (___self::_fls(___sz) - ___SL_LOG2___)) - 1U;
+
+				rx::u32 fl, sl;
+				___self::_mapping(___sz, fl, sl);
+
+				if (fl >= ___FL_COUNT___)
+					return NIL;
+
+				// search in current first level
+				rx::u32 sl_map = (sl < ___SL_COUNT___) ? (_sl_bitmap[fl] & (~0U << sl)) : 0U;
+
+				if (sl_map == 0U) {
+
+					// search in upper first levels
+					const rx::u64 fl_map = (fl + 1U < ___FL_COUNT___)
+										 ? (_fl_bitmap & (~rx::u64{0U} << (fl + 1U))) : 0U;
+
+					if (fl_map == 0U)
+						return NIL;
+
+					fl     = static_cast<rx::u32>(__builtin_ctzll(fl_map));
+					sl_map = _sl_bitmap[fl];
+				}
+
+				sl = static_cast<rx::u32>(__builtin_ctz(sl_map));
+
+				return _heads[fl][sl];
+			}
+
+
+			// -- private static methods --------------------------------------
+
+			/* find last set */
+			static auto _fls(const size_type& ___sz) noexcept -> rx::u32 {
+				return 63U - static_cast<rx::u32>(__builtin_clzll(___sz));
+			}
+
+			/* mapping */
+			static auto _mapping(const size_type& ___sz, rx::u32& ___fl, rx::u32& ___sl) noexcept -> void {
+
+				if (___sz < ___SMALL___) {
+					___fl = 0U;
+					___sl = static_cast<rx::u32>(___sz / (___SMALL___ / ___SL_COUNT___));
+					return;
+				}
+
+				const rx::u32 t = ___self::_fls(___sz);
+
+				___sl = static_cast<rx::u32>(___sz >> (t - ___SL_LOG2___)) ^ ___SL_COUNT___;
+				___fl = t - (___FL_SHIFT___ - 1U);
+			}
+
+	}; // class virtual_block
+
+} // namespace rx
+
+#endif // ___RENDERX_MEMORY_VIRTUAL_BLOCK___
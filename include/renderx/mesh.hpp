@@ -1,8 +1,6 @@
 #ifndef ___RENDERX_MESH___
 #define ___RENDERX_MESH___
 
-#include "renderx/vulkan/vertex_buffer.hpp"
-#include "renderx/vulkan/index_buffer.hpp"
 #include "renderx/shapes/cuboid.hpp"
 #include "engine/vertex/vertex.hpp"
 #include "engine/vulkan/command_buffer.hpp"
@@ -31,32 +29,45 @@ namespace rx {
 
 			// -- private members ---------------------------------------------
 
-			/* vertex buffer */
-			vulkan::vertex_buffer _vertices;
+			/* vertex offset in geometry pool */
+			vk::i32 _vertex_offset;
 
-			/* index buffer */
-			vulkan::index_buffer _indices;
+			/* first index in geometry pool */
+			vk::u32 _first_index;
 
+			/* index count */
+			vk::u32 _index_count;
 
-		public:
-
-			// -- public lifecycle --------------------------------------------
+			/* bounding sphere radius (around model origin) */
+			float _radius;
 
-			/* default constructor */
-			mesh(void) noexcept = default;
+			/* id (stable, sort key mesh field) */
+			vk::u16 _id;
 
-			/* vertices / indices constructor */
-			template <typename ___type, typename... ___params>
-			mesh(const vk::vector<engine::vertex<___params...>>& vertices, const vk::vector<___type>& indices)
-			: _vertices{vertices}, _indices{indices} {
 
+		public:
 
+			// -- public lifecycle --------------------------------------------
 
+			/* default constructor */
+			mesh(void) noexcept
+			: _vertex_offset{0}, _first_index{0U}, _index_count{0U}, _radius{0.0f}, _id{0U} {
+			}
 
+			/* offsets constructor */
+			mesh(const vk::i32& ___vertex_offset,
+				 const vk::u32& ___first_index,
+				 const vk::u32& ___index_count,
+				 const float& ___radius = 0.0f) noexcept
+			: _vertex_offset{___vertex_offset},
+			  _first_index{___first_index},
+			  _index_count{___index_count},
+			  _radius{___radius},
+			  _id{0U} {
 			}
 
-			/* deleted copy constructor */
-			mesh(const ___self&) = delete;
+			/* copy constructor */
+			mesh(const ___self&) noexcept = default;
 
 			/* move constructor */
 			mesh(___self&&) noexcept = default;
@@ -67,8 +78,8 @@ namespace rx {
 
 			// -- public assignment operators ---------------------------------
 
-			/* deleted copy assignment operator */
-			auto operator=(const ___self&) -> ___self& = delete;
+			/* copy assignment operator */
+			auto operator=(const ___self&) noexcept -> ___self& = default;
 
 			/* move assignment operator */
 			auto operator=(___self&&) noexcept -> ___self& = default;
@@ -76,29 +87,52 @@ namespace rx {
 
 			// -- public methods ----------------------------------------------
 
-			/* draw */
-			template <typename ___tb, typename ___constants>
-			auto draw(const vulkan::command_buffer<___tb>& encoder, const ___constants& constants) const -> void {
+			/* draw (geometry pool must be bound, command buffer or state tracker) */
+			template <typename ___encoder>
+			auto draw(___encoder& encoder) const noexcept -> void {
+				encoder.draw_indexed(_index_count, _first_index, _vertex_offset);
+			}
 
-				encoder.bind_vertex_buffer(_vertices);
-				encoder.bind_index_buffer(_indices);
-				encoder.push_constants(constants);
-				encoder.draw_indexed(_indices.count());
+			/* draw instanced (per-instance stream must be bound) */
+			template <typename ___encoder>
+			auto draw(___encoder& encoder,
+					  const vk::u32& ___count,
+					  const vk::u32& ___first) const noexcept -> void {
+				encoder.draw_indexed(_index_count, _first_index, _vertex_offset, ___count, ___first);
 			}
 
 
 			// -- public accessors --------------------------------------------
 
-			/* vertices */
-			auto vertices(void) const noexcept -> const vulkan::vertex_buffer& {
-				return _vertices;
+			/* vertex offset */
+			auto vertex_offset(void) const noexcept -> vk::i32 {
+				return _vertex_offset;
+			}
+
+			/* first index */
+			auto first_index(void) const noexcept -> vk::u32 {
+				return _first_index;
+			}
+
+			/* index count */
+			auto index_count(void) const noexcept -> vk::u32 {
+				return _index_count;
+			}
+
+			/* radius */
+			auto radius(void) const noexcept -> float {
+				return _radius;
 			}
 
-			/* indices */
-			auto indices(void) const noexcept -> const vulkan::index_buffer& {
-				return _indices;
+			/* id */
+			auto id(void) const noexcept -> vk::u16 {
+				return _id;
 			}
 
+			/* id (set by the owner, unique among its meshes) */
+			auto id(const vk::u16& ___id) noexcept -> void {
+				_id = ___id;
+			}
 
 	}; // class mesh
 
@@ -0,0 +1,258 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_RENDER_QUEUE___
+#define ___RENDERX_RENDER_QUEUE___
+
+#include "engine/types.hpp"
+
+#include <vector>
+
+
+// -- R X  N A M E S P A C E --------------------------------------------------
+
+namespace rx {
+
+
+	// -- R E N D E R  Q U E U E ----------------------------------------------
+
+	class render_queue final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* key type */
+			using key_type  = rx::u64;
+
+			/* size type */
+			using size_type = rx::u32;
+
+
+			// -- public structs ----------------------------------------------
+
+			/* item */
+			struct item final {
+
+				/* sort key */
+				key_type key;
+
+				/* payload (object index) */
+				size_type payload;
+
+			}; // struct item
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = rx::render_queue;
+
+
+			// -- private constants -------------------------------------------
+
+			/* key layout, most significant first
+			 * pass:4 | pipeline:12 | material:16 | mesh:16 | depth:16 */
+			enum : rx::u32 {
+				___DEPTH_SHIFT___    = 0U,
+				___MESH_SHIFT___     = 16U,
+				___MATERIAL_SHIFT___ = 32U,
+				___PIPELINE_SHIFT___ = 48U,
+				___PASS_SHIFT___     = 60U,
+
+				___PASS_MASK___      = 0xFU,
+				___PIPELINE_MASK___  = 0xFFFU,
+				___FIELD_MASK___     = 0xFFFFU,
+
+				/* radix digit bits */
+				___RADIX_BITS___     = 8U,
+				/* radix buckets */
+				___RADIX_SIZE___     = 1U << ___RADIX_BITS___,
+				/* radix passes (64-bit key) */
+				___RADIX_PASSES___   = 64U / ___RADIX_BITS___
+			};
+
+
+			// -- private members ---------------------------------------------
+
+			/* items */
+			std::vector<item> _items;
+
+			/* scatter buffer */
+			std::vector<item> _scratch;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor */
+			render_queue(void)
+			: _items{}, _scratch{} {
+			}
+
+			/* deleted copy constructor */
+			render_queue(const ___self&) = delete;
+
+			/* move constructor */
+			render_queue(___self&&) noexcept = default;
+
+			/* destructor */
+			~render_queue(void) noexcept = default;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* move assignment operator */
+			auto operator=(___self&&) noexcept -> ___self& = default;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* push */
+			auto push(const key_type& ___key, const size_type& ___payload) -> void {
+				_items.push_back(item{___key, ___payload});
+			}
+
+			/* sort (lsd radix, stable, byte passes with a single digit are skipped) */
+			auto sort(void) -> void {
+
+				const rx::size_t count = _items.size();
+
+				if (count < 2U)
+					return;
+
+				_scratch.resize(count);
+
+				// one histogram per digit, gathered in a single read
+				size_type histogram[___RADIX_PASSES___][___RADIX_SIZE___]{};
+
+				for (const auto& it : _items) {
+					for (rx::u32 p = 0U; p < ___RADIX_PASSES___; ++p)
+						++histogram[p][(it.key >> (p * ___RADIX_BITS___)) & (___RADIX_SIZE___ - 1U)];
+				}
+
+				item* src = _items.data();
+				item* dst = _scratch.data();
+
+				for (rx::u32 p = 0U; p < ___RADIX_PASSES___; ++p) {
+
+					size_type* counts = histogram[p];
+
+					const rx::u32 shift = p * ___RADIX_BITS___;
+
+					// every key shares this digit, order unchanged
+					if (counts[(src[0U].key >> shift) & (___RADIX_SIZE___ - 1U)] == count)
+						continue;
+
+					// exclusive prefix sum
+					size_type offset = 0U;
+
+					for (rx::u32 b = 0U; b < ___RADIX_SIZE___; ++b) {
+						const size_type n = counts[b];
+						counts[b] = offset;
+						offset += n;
+					}
+
+					for (rx::size_t i = 0U; i < count; ++i)
+						dst[counts[(src[i].key >> shift) & (___RADIX_SIZE___ - 1U)]++] = src[i];
+
+					item* tmp = src;
+					src = dst;
+					dst = tmp;
+				}
+
+				// odd number of scatters, result lives in scratch
+				if (src != _items.data())
+					_items.swap(_scratch);
+			}
+
+			/* clear */
+			auto clear(void) noexcept -> void {
+				_items.clear();
+			}
+
+			/* reserve */
+			auto reserve(const size_type& ___capacity) -> void {
+				_items.reserve(___capacity);
+				_scratch.reserve(___capacity);
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* size */
+			auto size(void) const noexcept -> size_type {
+				return static_cast<size_type>(_items.size());
+			}
+
+			/* empty */
+			auto empty(void) const noexcept -> bool {
+				return _items.empty();
+			}
+
+			/* subscript operator */
+			auto operator[](const size_type& ___index) const noexcept -> const item& {
+				return _items[___index];
+			}
+
+			/* begin */
+			auto begin(void) const noexcept -> std::vector<item>::const_iterator {
+				return _items.begin();
+			}
+
+			/* end */
+			auto end(void) const noexcept -> std::vector<item>::const_iterator {
+				return _items.end();
+			}
+
+
+			// -- public static methods ---------------------------------------
+
+			/* key (fields are truncated to their width) */
+			static constexpr auto key(const rx::u32& ___pass,
+									  const rx::u32& ___pipeline,
+									  const rx::u32& ___material,
+									  const rx::u32& ___mesh,
+									  const rx::u16& ___depth) noexcept -> key_type {
+
+				return (static_cast<key_type>(___pass     & ___PASS_MASK___)     << ___PASS_SHIFT___)
+					 | (static_cast<key_type>(___pipeline & ___PIPELINE_MASK___) << ___PIPELINE_SHIFT___)
+					 | (static_cast<key_type>(___material & ___FIELD_MASK___)    << ___MATERIAL_SHIFT___)
+					 | (static_cast<key_type>(___mesh     & ___FIELD_MASK___)    << ___MESH_SHIFT___)
+					 | (static_cast<key_type>(___depth)                          << ___DEPTH_SHIFT___);
+			}
+
+			/* quantize depth (view depth in [near, far] to 16 bits, near first) */
+			static constexpr auto quantize_depth(const float& ___depth,
+												 const float& ___near,
+												 const float& ___far) noexcept -> rx::u16 {
+
+				if (___depth <= ___near)
+					return 0U;
+
+				if (___depth >= ___far)
+					return ___FIELD_MASK___;
+
+				return static_cast<rx::u16>(((___depth - ___near) / (___far - ___near))
+						* static_cast<float>(___FIELD_MASK___));
+			}
+
+	}; // class render_queue
+
+} // namespace rx
+
+#endif // ___RENDERX_RENDER_QUEUE___
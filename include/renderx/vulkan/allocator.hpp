@@ -6,6 +6,10 @@
 #include "engine/vk/utils.hpp"
 #include "renderx/hint.hpp"
 #include "renderx/memory/memcpy.hpp"
+#include "renderx/vulkan/memory_pool.hpp"
+#include "renderx/vulkan/memory_stats.hpp"
+
+#include <stdexcept>
 
 
 // -- V U L K A N -------------------------------------------------------------
@@ -29,27 +33,23 @@ namespace vulkan {
 		/* data */
 		void* data;
 
+		/* block */
+		vulkan::memory_block* block;
+
+		/* node */
+		vulkan::memory_block::node_type node;
 
-		/* unmap */
-		auto unmap(void) noexcept -> void {
-			::vk_unmap_memory(vulkan::device::logical(), memory);
-		}
 
 		/* memcpy */
 		template <typename ___type>
-		auto memcpy(const ___type* src) noexcept -> void {
+		auto memcpy(const ___type* src, const rx::size_t count) -> void {
 
-			// map memory
-			vk::try_execute<"failed to map memory">(
-					::vk_map_memory, vulkan::device::logical(),
-					memory, offset, size,
-					0U /* reserved */, &data);
+			// device local memory is never mapped
+			if (data == nullptr)
+				throw std::runtime_error("allocation is not host visible");
 
-			// copy data
-			rx::memcpy(data, src, size);
-
-			// unmap memory
-			::vk_unmap_memory(vulkan::device::logical(), memory);
+			// block is persistently mapped, plain copy
+			rx::memcpy(data, src, count);
 		}
 
 	};
@@ -111,198 +111,269 @@ namespace vulkan {
 
 			// -- private constants -------------------------------------------
 
-			/* default block size */
-			enum : vk::device_size {
-				___DEFAULT_BLOCK_SIZE___ = 256U * 1024U * 1024U
+			/* default idle period (nanoseconds) */
+			enum : rx::umax {
+				___DEFAULT_IDLE_PERIOD___ = 5'000'000'000U
 			};
 
 
-			// -- allocation types --------------------------------------------
+			// -- private members ---------------------------------------------
 
+			/* pools */
+			vulkan::memory_pool* _pools[VK_MAX_MEMORY_TYPES];
 
+			/* idle period */
+			rx::umax _idle_period;
 
 
-			// -- private classes ---------------------------------------------
+		public:
 
+			// -- public lifecycle -------------------------------------------
 
-			/* linear */
-			class linear final {
+			/* default constructor */
+			allocator(void)
+			: _pools{}, _idle_period{___DEFAULT_IDLE_PERIOD___} {
+			}
 
+			/* idle period constructor */
+			allocator(const rx::umax& ___idle)
+			: _pools{}, _idle_period{___idle} {
+			}
 
-				private:
+			/* destructor */
+			~allocator(void) noexcept {
 
-					// -- private types ---------------------------------------
+				for (vk::u32 i = 0U; i < VK_MAX_MEMORY_TYPES; ++i) {
+					if (_pools[i] == nullptr)
+						continue;
 
-					/* self type */
-					using ___self = vulkan::allocator<___type>::linear;
+					delete _pools[i];
+				}
 
+			}
 
-					// -- private members -------------------------------------
 
-					/* memory */
-					vk::device_memory _memory;
+			auto allocate_buffer(const vk::buffer& buffer/*, const vk::memory_property_flags& properties*/) -> vulkan::allocation {
 
-					/* offset */
-					vk::device_size _offset;
+				vk::memory_dedicated_requirements dedicated {
+					.sType                       = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS,
+					.pNext                       = nullptr,
+					.prefersDedicatedAllocation  = VK_FALSE,
+					.requiresDedicatedAllocation = VK_FALSE
+				};
 
+				vk::memory_requirements2 requirements2 {
+					.sType              = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2,
+					.pNext              = &dedicated,
+					.memoryRequirements = {}
+				};
 
-				public:
+				const vk::buffer_memory_requirements_info2 info {
+					.sType  = VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2,
+					.pNext  = nullptr,
+					.buffer = buffer
+				};
 
-					/* deleted default constructor */
-					linear(void) = delete;
+				// get buffer memory requirements (and dedicated preference)
+				::vk_get_buffer_memory_requirements2(vulkan::device::logical(), &info, &requirements2);
 
-					/* memory type constructor */
-					linear(const vk::u32& memory_type_bits)
-					: /* uninitialized device memory */ _offset{0U} {
+				const vk::memory_requirements& requirements = requirements2.memoryRequirements;
 
-						// create info
-						const vk::memory_allocate_info info {
-							// structure type
-							VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-							// next structure
-							nullptr,
-							// allocation size
-							___DEFAULT_BLOCK_SIZE___,
-							// memory type index
-							memory_type_bits
-						};
+				// find memory type
+				const auto memory_type = ___self::_find_memory_type(requirements.memoryTypeBits/*, ___type::property*/);
 
-						// create device memory
-						vk::try_execute<"failed to allocate memory">(
-								::vk_allocate_memory,
-								vulkan::device::logical(), &info, nullptr, &_memory);
 
-						rx::hint::success("new memory block allocated");
-					}
+				// check if pool is valid
+				if (_pools[memory_type] == nullptr) {
+					_pools[memory_type] = new vulkan::memory_pool{memory_type, _idle_period};
+				}
 
-					/* deleted copy constructor */
-					linear(const ___self&) = delete;
+				auto& pool = *_pools[memory_type];
 
-					/* deleted move constructor */
-					linear(___self&&) = delete;
+				// driver preference, or too large to share a block
+				if (dedicated.prefersDedicatedAllocation  == VK_TRUE
+				 || dedicated.requiresDedicatedAllocation == VK_TRUE
+				 || requirements.size > pool.dedicated_threshold()) {
 
-					/* destructor */
-					~linear(void) noexcept {
+					vulkan::memory_block::range range;
 
-						// release device memory
-						::vk_free_memory(
-								vulkan::device::logical(), _memory, nullptr);
+					auto& block = pool.allocate_dedicated(requirements, buffer, range);
 
-						rx::hint::info("memory block released");
-					}
+					return ___self::_bind(pool, buffer, requirements, block, range);
+				}
 
+				vulkan::memory_block::range range;
 
-					// -- public assignment operators -------------------------
+				// allocate memory (chains a new block when all are full)
+				auto& block = pool.allocate(requirements, range);
 
-					/* deleted copy assignment operator */
-					auto operator=(const ___self&) -> ___self& = delete;
+				//// map memory
+				//vk::try_execute<"failed to map memory">(
+				//		::vk_map_memory, vulkan::device::logical(),
+				//		alloc.memory, alloc.offset, alloc.size,
+				//		0U /* reserved */, &alloc.data);
 
-					/* deleted move assignment operator */
-					auto operator=(___self&&) -> ___self& = delete;
+				return ___self::_bind(pool, buffer, requirements, block, range);
+			}
 
+			/* relocate buffer (existing blocks other than exclude only) */
+			auto relocate_buffer(const vk::buffer& buffer,
+								 const vulkan::memory_block& ___exclude,
+								 vulkan::allocation& ___alloc) -> bool {
 
-					/* allocate */
-					auto allocate(const vk::memory_requirements& requirements) -> vulkan::allocation {
+				vk::memory_requirements requirements;
 
+				// get buffer memory requirements
+				::vk_get_buffer_memory_requirements(vulkan::device::logical(), buffer, &requirements);
 
-						vk::device_size aligned_offset = (_offset + requirements.alignment - 1U)
-														& ~(requirements.alignment - 1U);
+				vulkan::memory_pool* pool = _pools[___exclude.type()];
 
-						// check if memory is out of bounds
-						if (aligned_offset + requirements.size > ___DEFAULT_BLOCK_SIZE___) {
-							throw std::runtime_error("out of memory bounds");
-							// not implemented...
-							// will expand memory with linked list ?
-						}
+				// memory type must stay the same
+				if ((requirements.memoryTypeBits & (1U << ___exclude.type())) == 0U)
+					return false;
 
-						_offset = aligned_offset + requirements.size;
+				vulkan::memory_block::range range;
 
-						return {
-							_memory,
-							requirements.size,
-							aligned_offset,
-							nullptr
-						};
-					}
+				// never grows the pool, a move must not reserve memory
+				auto* block = pool->allocate_elsewhere(requirements, range, &___exclude);
 
-					/* reset */
-					auto reset(void) noexcept -> void {
-						_offset = 0U;
-					}
+				if (block == nullptr)
+					return false;
 
-					/* memory */
-					auto memory(void) const noexcept -> const vk::device_memory& {
-						return _memory;
-					}
+				___alloc = ___self::_bind(*pool, buffer, requirements, *block, range);
 
-			};
+				return true;
+			}
 
+			/* free */
+			auto free(vulkan::allocation& alloc) -> void {
 
+				// check if allocation is valid
+				if (alloc.block == nullptr)
+					return;
 
-			// -- private members ---------------------------------------------
+				// return range to its block free lists
+				_pools[alloc.block->type()]->free(*alloc.block, alloc.node);
 
-			/* allocators */
-			___self::linear* _allocators[VK_MAX_MEMORY_TYPES];
+				// invalidate allocation
+				alloc.block  = nullptr;
+				alloc.node   = vulkan::memory_block::NIL;
+				alloc.memory = nullptr;
+				alloc.data   = nullptr;
+			}
 
+			/* trim (release every empty block now) */
+			auto trim(void) noexcept -> void {
 
-		public:
+				for (vk::u32 i = 0U; i < VK_MAX_MEMORY_TYPES; ++i) {
+					if (_pools[i] != nullptr)
+						_pools[i]->trim();
+				}
+			}
 
-			// -- public lifecycle -------------------------------------------
+			/* sparsest block of all pools */
+			auto sparsest(const float ___ratio) const noexcept -> vulkan::memory_block* {
 
-			/* default constructor */
-			allocator(void)
-			: _allocators{} {
-			}
+				vulkan::memory_block* sparse = nullptr;
 
-			/* destructor */
-			~allocator(void) noexcept {
+				float lowest = ___ratio;
 
 				for (vk::u32 i = 0U; i < VK_MAX_MEMORY_TYPES; ++i) {
-					if (_allocators[i] == nullptr)
+
+					if (_pools[i] == nullptr)
 						continue;
 
-					delete _allocators[i];
+					auto* block = _pools[i]->sparsest(lowest);
+
+					if (block == nullptr)
+						continue;
+
+					sparse = block;
+					lowest = static_cast<float>(block->used())
+						   / static_cast<float>(block->size());
 				}
 
+				return sparse;
 			}
 
+			/* collect */
+			auto collect(void) noexcept -> void {
 
-			auto allocate_buffer(const vk::buffer& buffer/*, const vk::memory_property_flags& properties*/) -> vulkan::allocation {
+				const rx::umax now = rx::now();
 
-				vk::memory_requirements requirements;
+				// release blocks idle for longer than idle period
+				for (vk::u32 i = 0U; i < VK_MAX_MEMORY_TYPES; ++i) {
+					if (_pools[i] != nullptr)
+						_pools[i]->collect(now);
+				}
+			}
 
-				// get buffer memory requirements
-				::vk_get_buffer_memory_requirements(vulkan::device::logical(), buffer, &requirements);
+			/* stats (accumulate) */
+			auto stats(vulkan::memory_stats& ___stats) const noexcept -> void {
 
-				// find memory type
-				const auto memory_type = ___self::_find_memory_type(requirements.memoryTypeBits/*, ___type::property*/);
+				for (vk::u32 i = 0U; i < VK_MAX_MEMORY_TYPES; ++i) {
+					if (_pools[i] != nullptr)
+						___stats.accumulate(*_pools[i]);
+				}
+			}
 
+			/* stats (snapshot) */
+			auto stats(void) const -> vulkan::memory_stats {
 
-				// check if allocator is valid
-				if (_allocators[memory_type] == nullptr) {
-					_allocators[memory_type] = new linear{memory_type};
-				}
+				vulkan::memory_stats snapshot;
+				___self::stats(snapshot);
 
-				// allocate memory
-				auto alloc = _allocators[memory_type]->allocate(requirements);
+				return snapshot;
+			}
 
-				// bind memory
-				vk::try_execute<"failed to bind buffer memory">(
-						::vk_bind_buffer_memory, vulkan::device::logical(),
-						buffer, alloc.memory, alloc.offset);
+			/* idle period */
+			auto idle_period(const rx::umax& ___idle) noexcept -> void {
 
-				//// map memory
-				//vk::try_execute<"failed to map memory">(
-				//		::vk_map_memory, vulkan::device::logical(),
-				//		alloc.memory, alloc.offset, alloc.size,
-				//		0U /* reserved */, &alloc.data);
+				_idle_period = ___idle;
 
-				return alloc;
+				for (vk::u32 i = 0U; i < VK_MAX_MEMORY_TYPES; ++i) {
+					if (_pools[i] != nullptr)
+						_pools[i]->idle_period(___idle);
+				}
 			}
 
 
 
 
+			/* bind (range goes back to pool if binding fails) */
+			static auto _bind(vulkan::memory_pool& ___pool,
+							  const vk::buffer& buffer,
+							  const vk::memory_requirements& ___req,
+							  vulkan::memory_block& ___block,
+							  const vulkan::memory_block::range& ___rg) -> vulkan::allocation {
+
+				vulkan::allocation alloc {
+					___block.memory(),
+					___req.size,
+					___rg.offset,
+					// persistently mapped pointer (host visible only)
+					___block.mapped() != nullptr
+						? static_cast<vk::u8*>(___block.mapped()) + ___rg.offset
+						: nullptr,
+					&___block,
+					___rg.node
+				};
+
+				try {
+					// bind memory
+					vk::try_execute<"failed to bind buffer memory">(
+							::vk_bind_buffer_memory, vulkan::device::logical(),
+							buffer, alloc.memory, alloc.offset);
+				}
+				catch (...) {
+					// dedicated blocks are released by the pool as well
+					___pool.free(___block, ___rg.node);
+					throw;
+				}
+
+				return alloc;
+			}
+
 			/* find memory type */
 			static auto _find_memory_type(const vk::u32& mem_type/*, vk::memory_property_flags flags*/) -> vk::u32 {
 
@@ -322,6 +393,18 @@ namespace vulkan {
 						return i;
 				}
 
+				// cached is a preference, any host visible type will do
+				// (flushes are skipped when it turns out coherent)
+				if constexpr ((flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT) != 0U) {
+
+					for (vk::u32 i = 0U; i < properties.memoryTypeCount; ++i) {
+
+						if (((mem_type & (1U << i)) != 0U)
+							&& ((properties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0U))
+							return i;
+					}
+				}
+
 				throw std::runtime_error("failed to find memory type");
 			}
 
@@ -0,0 +1,389 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_DEFRAGMENTER___
+#define ___RENDERX_VULKAN_DEFRAGMENTER___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vulkan/buffer.hpp"
+#include "engine/vulkan/fence.hpp"
+#include "engine/vulkan/queue.hpp"
+#include "engine/vulkan/commands.hpp"
+#include "engine/vulkan/command_pool.hpp"
+#include "engine/vulkan/command_buffer.hpp"
+
+#include "renderx/vulkan/allocator.hpp"
+#include "renderx/vulkan/uploader.hpp"
+#include "renderx/time/now.hpp"
+
+#include <vector>
+#include <utility>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- D E F R A G M E N T E R ---------------------------------------------
+
+	template <typename ___type>
+	class defragmenter final {
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::defragmenter<___type>;
+
+
+			/* tracked buffer */
+			struct ___entry final {
+
+				/* owning buffer (patched on move) */
+				vulkan::buffer* buffer;
+
+				/* owning allocation (patched on move) */
+				vulkan::allocation* alloc;
+
+			}; // struct ___entry
+
+
+			/* retired buffer (released once copies complete) */
+			struct ___retired final {
+
+				/* old buffer handle */
+				vk::buffer buffer;
+
+				/* old allocation */
+				vulkan::allocation alloc;
+
+			}; // struct ___retired
+
+
+			// -- private constants -------------------------------------------
+
+			/* occupancy below which a block is evacuated */
+			static constexpr float ___SPARSE_RATIO___ = 0.5f;
+
+
+			// -- private members ---------------------------------------------
+
+			/* queue */
+			const vulkan::queue& _queue;
+
+			/* allocator */
+			vulkan::allocator<___type>& _allocator;
+
+			/* uploader (copies into tracked buffers) */
+			vulkan::uploader& _uploader;
+
+			/* command pool */
+			vulkan::command_pool _pool;
+
+			/* command buffer */
+			vulkan::commands<vulkan::primary> _cmds;
+
+			/* fence */
+			vulkan::fence _fence;
+
+			/* tracked buffers */
+			std::vector<___entry> _entries;
+
+			/* retired buffers of the pass in flight */
+			std::vector<___retired> _retired;
+
+			/* pass in flight */
+			bool _pending;
+
+			/* moved bytes (lifetime) */
+			vk::device_size _moved;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			defragmenter(void) = delete;
+
+			/* queue / allocator / uploader constructor */
+			defragmenter(const vulkan::queue& ___queue,
+						 vulkan::allocator<___type>& ___allocator,
+						 vulkan::uploader& ___uploader)
+			: _queue{___queue}, _allocator{___allocator}, _uploader{___uploader},
+			  _pool{VK_COMMAND_POOL_CREATE_TRANSIENT_BIT
+				  | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT},
+			  _cmds{_pool.underlying(), 1U},
+			  _fence{VK_FENCE_CREATE_SIGNALED_BIT},
+			  _entries{}, _retired{}, _pending{false}, _moved{0U} {
+			}
+
+			/* deleted copy constructor */
+			defragmenter(const ___self&) = delete;
+
+			/* deleted move constructor */
+			defragmenter(___self&&) = delete;
+
+			/* destructor */
+			~defragmenter(void) noexcept {
+
+				if (_pending == false)
+					return;
+
+				// wait pass in flight, then release old ranges
+				_fence.wait();
+				___self::_release();
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* track (owner must outlive tracking) */
+			auto track(vulkan::buffer& ___buffer, vulkan::allocation& ___alloc) -> void {
+				_entries.push_back(___entry{&___buffer, &___alloc});
+			}
+
+			/* untrack */
+			auto untrack(const vulkan::buffer& ___buffer) noexcept -> void {
+
+				for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+					if (it->buffer == &___buffer) {
+						_entries.erase(it);
+						return;
+					}
+				}
+			}
+
+			/* step (at most one pass in flight, budget in nanoseconds) */
+			auto step(const rx::umax& ___budget) -> void {
+
+				// previous pass still copying
+				if (_pending == true) {
+
+					if (_fence.signaled() == false)
+						return;
+
+					___self::_release();
+				}
+
+				auto* block = _allocator.sparsest(___SPARSE_RATIO___);
+
+				if (block == nullptr)
+					return;
+
+				// recorded or in flight copies target the current handles,
+				// a move would lose them or release a buffer still written
+				// (transfer queue is not ordered with the fence below)
+				if (_uploader.complete(_uploader.submit()) == false)
+					return;
+
+				const rx::umax start = rx::now();
+
+				auto& cmd = _cmds[0U];
+				vk::u32 moves = 0U;
+
+				for (auto& entry : _entries) {
+
+					if (entry.alloc->block != block)
+						continue;
+
+					// frame budget spent, resume next frame
+					if (rx::now() - start >= ___budget)
+						break;
+
+					if (moves == 0U) {
+						cmd.reset();
+						cmd.begin();
+
+						// prior writes (uploads) complete before reading
+						cmd.memory_barrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+										   VK_PIPELINE_STAGE_TRANSFER_BIT,
+										   VK_ACCESS_TRANSFER_WRITE_BIT,
+										   VK_ACCESS_TRANSFER_READ_BIT);
+					}
+
+					// no room left outside sparse block
+					if (___self::_move(cmd, entry, *block) == false)
+						break;
+
+					++moves;
+				}
+
+				// nothing moved, recording is reset next pass
+				if (moves == 0U)
+					return;
+
+				// moved data visible to vertex input of later submissions
+				cmd.memory_barrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+								   VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+								   VK_ACCESS_TRANSFER_WRITE_BIT,
+								   VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT);
+
+				cmd.end();
+
+				_fence.reset();
+				_queue.submit(cmd, _fence.underlying());
+
+				_pending = true;
+			}
+
+			/* wait (pass in flight, call before writing a tracked buffer) */
+			auto wait(void) -> void {
+
+				if (_pending == false)
+					return;
+
+				// copies of the pass would overwrite newer writes
+				_fence.wait();
+				___self::_release();
+			}
+
+			/* resize (blocking, contents are kept and the owner is patched,
+			 * commands recorded with the old buffer must be re-recorded) */
+			auto resize(vulkan::buffer& ___buffer, vulkan::allocation& ___alloc,
+						const vk::device_size& ___size) -> void {
+
+				// nothing in flight reads or writes the old buffer
+				___self::wait();
+				_uploader.wait(_uploader.submit());
+
+				vulkan::buffer fresh{___size, ___buffer.usage()};
+
+				// unlike a move, may chain a new block
+				vulkan::allocation alloc = _allocator.allocate_buffer(fresh.underlying());
+
+				try {
+					auto& cmd = _cmds[0U];
+
+					cmd.reset();
+					cmd.begin();
+
+					// prior writes (uploads) complete before reading
+					cmd.memory_barrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+									   VK_PIPELINE_STAGE_TRANSFER_BIT,
+									   VK_ACCESS_TRANSFER_WRITE_BIT,
+									   VK_ACCESS_TRANSFER_READ_BIT);
+
+					cmd.copy_buffer(___buffer.underlying(), fresh.underlying(),
+							vk::buffer_copy{0U, 0U, ___buffer.size()});
+
+					// copied data visible to vertex input and later uploads
+					cmd.memory_barrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+									   VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+									   VK_ACCESS_TRANSFER_WRITE_BIT,
+									   VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT
+									 | VK_ACCESS_TRANSFER_WRITE_BIT);
+
+					cmd.end();
+
+					_fence.reset();
+					_queue.submit(cmd, _fence.underlying());
+
+					// earlier frames of this queue are done as well
+					_fence.wait();
+				}
+				catch (...) {
+					_allocator.free(alloc);
+					throw;
+				}
+
+				_retired.push_back(___retired{___buffer.release(), ___alloc});
+
+				// patch owner
+				___buffer = std::move(fresh);
+				___alloc  = alloc;
+
+				___self::_release();
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* moved bytes */
+			auto moved(void) const noexcept -> vk::device_size {
+				return _moved;
+			}
+
+			/* pending */
+			auto pending(void) const noexcept -> bool {
+				return _pending;
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* move */
+			auto _move(const vulkan::command_buffer<vulkan::primary>& ___cmd,
+					   ___entry& ___entry, const vulkan::memory_block& ___block) -> bool {
+
+				vulkan::buffer& owner = *___entry.buffer;
+
+				// same size and usage as the owner, movable again later
+				vulkan::buffer fresh{owner.size(), owner.usage()
+									| VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+									| VK_BUFFER_USAGE_TRANSFER_DST_BIT};
+
+				vulkan::allocation alloc;
+
+				if (_allocator.relocate_buffer(fresh.underlying(), ___block, alloc) == false)
+					return false;
+
+				___cmd.copy_buffer(owner.underlying(), fresh.underlying(),
+						vk::buffer_copy{0U, 0U, owner.size()});
+
+				// keep old handle alive until the copy completes
+				_retired.push_back(___retired{owner.release(), *___entry.alloc});
+
+				// patch owner
+				owner           = std::move(fresh);
+				*___entry.alloc = alloc;
+
+				_moved += owner.size();
+
+				return true;
+			}
+
+			/* release */
+			auto _release(void) noexcept -> void {
+
+				for (auto& retired : _retired) {
+
+					::vk_destroy_buffer(vulkan::device::logical(),
+							retired.buffer, nullptr);
+
+					_allocator.free(retired.alloc);
+				}
+
+				_retired.clear();
+				_pending = false;
+
+				// emptied blocks go back to the driver
+				_allocator.trim();
+			}
+
+	}; // class defragmenter
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_DEFRAGMENTER___
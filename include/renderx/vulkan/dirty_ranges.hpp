@@ -0,0 +1,227 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_DIRTY_RANGES___
+#define ___RENDERX_VULKAN_DIRTY_RANGES___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vk/functions.hpp"
+#include "engine/vk/utils.hpp"
+#include "engine/vulkan/device.hpp"
+
+#include "renderx/vulkan/allocator.hpp"
+
+#include <vector>
+#include <algorithm>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- D I R T Y  R A N G E S ----------------------------------------------
+
+	class dirty_ranges final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* size type */
+			using size_type = vk::device_size;
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::dirty_ranges;
+
+
+			// -- private members ---------------------------------------------
+
+			/* marked ranges (atom aligned, unsorted) */
+			std::vector<vk::mapped_memory_range> _ranges;
+
+			/* non coherent atom size */
+			size_type _atom;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor */
+			dirty_ranges(void)
+			: _ranges{}, _atom{___self::_atom_size()} {
+			}
+
+			/* deleted copy constructor */
+			dirty_ranges(const ___self&) = delete;
+
+			/* deleted move constructor */
+			dirty_ranges(___self&&) = delete;
+
+			/* destructor */
+			~dirty_ranges(void) noexcept = default;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* mark (range relative to allocation, no-op on coherent memory) */
+			auto mark(const vulkan::allocation& ___alloc,
+					  const size_type& ___offset,
+					  const size_type& ___size) -> void {
+
+				if (___alloc.block == nullptr
+				 || ___alloc.block->coherent() == true
+				 || ___size == 0U)
+					return;
+
+				const size_type begin = ___alloc.offset + ___offset;
+
+				// round outwards to whole atoms
+				const size_type first = begin & ~(_atom - 1U);
+				size_type       last  = (begin + ___size + _atom - 1U) & ~(_atom - 1U);
+
+				// last atom may be cut by the end of the memory
+				if (last > ___alloc.block->size())
+					last = ___alloc.block->size();
+
+				_ranges.push_back(vk::mapped_memory_range{
+					.sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+					.pNext  = nullptr,
+					.memory = ___alloc.block->memory(),
+					.offset = first,
+					.size   = last - first
+				});
+			}
+
+			/* mark (whole allocation) */
+			auto mark(const vulkan::allocation& ___alloc) -> void {
+				___self::mark(___alloc, 0U, ___alloc.size);
+			}
+
+			/* flush (host writes visible to device, one call) */
+			auto flush(void) -> void {
+
+				if (___self::_merge() == 0U)
+					return;
+
+				vk::try_execute<"failed to flush memory">(
+						::vk_flush_mapped_memory_ranges,
+						vulkan::device::logical(),
+						static_cast<vk::u32>(_ranges.size()),
+						_ranges.data());
+
+				_ranges.clear();
+			}
+
+			/* invalidate (device writes visible to host, one call) */
+			auto invalidate(void) -> void {
+
+				if (___self::_merge() == 0U)
+					return;
+
+				vk::try_execute<"failed to invalidate mapped memory ranges">(
+						::vk_invalidate_mapped_memory_ranges,
+						vulkan::device::logical(),
+						static_cast<vk::u32>(_ranges.size()),
+						_ranges.data());
+
+				_ranges.clear();
+			}
+
+			/* clear */
+			auto clear(void) noexcept -> void {
+				_ranges.clear();
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* pending ranges (before merge) */
+			auto pending(void) const noexcept -> vk::u32 {
+				return static_cast<vk::u32>(_ranges.size());
+			}
+
+			/* atom size */
+			auto atom(void) const noexcept -> size_type {
+				return _atom;
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* merge (sort and coalesce overlapping or adjacent ranges) */
+			auto _merge(void) -> rx::size_t {
+
+				if (_ranges.size() < 2U)
+					return _ranges.size();
+
+				std::sort(_ranges.begin(), _ranges.end(),
+					[](const vk::mapped_memory_range& a, const vk::mapped_memory_range& b) noexcept -> bool {
+						return a.memory != b.memory ? a.memory < b.memory : a.offset < b.offset;
+				});
+
+				rx::size_t out = 0U;
+
+				for (rx::size_t i = 1U; i < _ranges.size(); ++i) {
+
+					auto& prev = _ranges[out];
+					auto& next = _ranges[i];
+
+					// disjoint, keep as its own range
+					if (next.memory != prev.memory || next.offset > prev.offset + prev.size) {
+						_ranges[++out] = next;
+						continue;
+					}
+
+					const size_type end = next.offset + next.size;
+
+					if (end > prev.offset + prev.size)
+						prev.size = end - prev.offset;
+				}
+
+				_ranges.resize(out + 1U);
+
+				return _ranges.size();
+			}
+
+
+			// -- private static methods --------------------------------------
+
+			/* atom size */
+			static auto _atom_size(void) noexcept -> size_type {
+
+				const auto properties = vk::get_physical_device_properties(vulkan::device::physical());
+
+				return properties.limits.nonCoherentAtomSize;
+			}
+
+	}; // class dirty_ranges
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_DIRTY_RANGES___
@@ -0,0 +1,278 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_FRAME_RING___
+#define ___RENDERX_VULKAN_FRAME_RING___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vk/functions.hpp"
+#include "engine/vulkan/device.hpp"
+#include "engine/vulkan/buffer.hpp"
+#include "engine/vulkan/frame_pacer.hpp"
+
+#include "renderx/vulkan/allocator.hpp"
+#include "renderx/vulkan/dirty_ranges.hpp"
+#include "renderx/memory/memcpy.hpp"
+
+#include <stdexcept>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- F R A M E  R I N G --------------------------------------------------
+
+	template <typename ___memory = vulkan::cpu_cached>
+	class frame_ring final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* size type */
+			using size_type = vk::device_size;
+
+
+			/* slice */
+			struct slice final {
+
+				/* mapped pointer */
+				void* data;
+
+				/* offset in ring buffer */
+				size_type offset;
+
+			}; // struct slice
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::frame_ring<___memory>;
+
+
+			// -- private constants -------------------------------------------
+
+			enum : size_type {
+				/* default bytes per frame */
+				___DEFAULT_FRAME_SIZE___ = 1024U * 1024U
+			};
+
+
+			// -- private members ---------------------------------------------
+
+			/* frame pacer (resets the slice of each waited frame) */
+			vulkan::frame_pacer& _pacer;
+
+			/* host allocator (shared) */
+			vulkan::allocator<___memory>& _host;
+
+			/* ring buffer */
+			vulkan::buffer _buffer;
+
+			/* ring allocation (persistently mapped) */
+			vulkan::allocation _memory;
+
+			/* bytes per frame */
+			size_type _frame_size;
+
+			/* default alignment */
+			size_type _alignment;
+
+			/* current frame */
+			vk::u32 _frame;
+
+			/* bump offset in current frame */
+			size_type _head;
+
+			/* written slices (shared, flushed once per frame by the owner) */
+			vulkan::dirty_ranges& _dirty;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			frame_ring(void) = delete;
+
+			/* pacer / host allocator / dirty ranges constructor */
+			frame_ring(vulkan::frame_pacer& ___pacer,
+					   vulkan::allocator<___memory>& ___host,
+					   vulkan::dirty_ranges& ___dirty)
+			: ___self{___pacer, ___host, ___dirty, ___DEFAULT_FRAME_SIZE___} {
+			}
+
+			/* pacer / host allocator / dirty ranges / frame size constructor */
+			frame_ring(vulkan::frame_pacer& ___pacer,
+					   vulkan::allocator<___memory>& ___host,
+					   vulkan::dirty_ranges& ___dirty,
+					   const size_type& ___frame_size)
+			: _pacer{___pacer},
+			  _host{___host},
+			  _buffer{},
+			  _memory{},
+			  _frame_size{0U},
+			  _alignment{___self::_min_alignment()},
+			  _frame{___pacer.current_frame()},
+			  _head{0U},
+			  _dirty{___dirty} {
+
+				// keep every slice start aligned
+				_frame_size = ___self::_align(___frame_size, _alignment);
+
+				// one slice per pacer slot
+				_buffer = vulkan::buffer{_frame_size * vulkan::frame_pacer::max_frames,
+										 VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT
+									   | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+									   | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT
+									   | VK_BUFFER_USAGE_INDEX_BUFFER_BIT};
+
+				_memory = _host.allocate_buffer(_buffer.underlying());
+
+				try {
+					_pacer.attach(&___self::_reset, this);
+				}
+				catch (...) {
+					_host.free(_memory);
+					throw;
+				}
+			}
+
+			/* deleted copy constructor */
+			frame_ring(const ___self&) = delete;
+
+			/* deleted move constructor */
+			frame_ring(___self&&) = delete;
+
+			/* destructor */
+			~frame_ring(void) noexcept {
+				_pacer.detach(this);
+				_host.free(_memory);
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* allocate */
+			auto allocate(const size_type& ___size) -> slice {
+				return ___self::allocate(___size, _alignment);
+			}
+
+			/* allocate */
+			auto allocate(const size_type& ___size, const size_type& ___align) -> slice {
+
+				const size_type offset = ___self::_align(_head, ___align);
+
+				// check slice bounds
+				if (offset + ___size > _frame_size)
+					throw std::runtime_error("frame ring out of memory");
+
+				_head = offset + ___size;
+
+				const size_type absolute = (_frame * _frame_size) + offset;
+
+				// flushed with the rest of the frame
+				_dirty.mark(_memory, absolute, ___size);
+
+				return slice{static_cast<vk::u8*>(_memory.data) + absolute, absolute};
+			}
+
+			/* push */
+			template <typename ___type>
+			auto push(const ___type& ___value) -> size_type {
+
+				const slice sl = ___self::allocate(sizeof(___type));
+
+				// copy into mapped slice
+				rx::memcpy(sl.data, &___value, 1U);
+
+				return sl.offset;
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* underlying */
+			auto underlying(void) const noexcept -> const vk::buffer& {
+				return _buffer.underlying();
+			}
+
+			/* frame size */
+			auto frame_size(void) const noexcept -> size_type {
+				return _frame_size;
+			}
+
+			/* used bytes in current frame */
+			auto used(void) const noexcept -> size_type {
+				return _head;
+			}
+
+			/* available bytes in current frame (with alignment) */
+			auto available(const size_type& ___align) const noexcept -> size_type {
+				const size_type offset = ___self::_align(_head, ___align);
+				return offset < _frame_size ? _frame_size - offset : 0U;
+			}
+
+			/* alignment */
+			auto alignment(void) const noexcept -> size_type {
+				return _alignment;
+			}
+
+
+		private:
+
+			// -- private static methods --------------------------------------
+
+			/* reset (pacer hook, slice of this slot is no longer read by the gpu) */
+			static auto _reset(void* ___ring, const vk::u32& ___frame) noexcept -> void {
+
+				___self& ring = *static_cast<___self*>(___ring);
+
+				ring._frame = ___frame;
+				ring._head  = 0U;
+			}
+
+			/* align */
+			static constexpr auto _align(const size_type& ___value, const size_type& ___align) noexcept -> size_type {
+				return (___value + ___align - 1U) & ~(___align - 1U);
+			}
+
+			/* min alignment */
+			static auto _min_alignment(void) noexcept -> size_type {
+
+				const auto properties = vk::get_physical_device_properties(vulkan::device::physical());
+
+				const size_type ubo  = properties.limits.minUniformBufferOffsetAlignment;
+				const size_type ssbo = properties.limits.minStorageBufferOffsetAlignment;
+
+				// satisfy both uniform and storage bindings
+				return ubo > ssbo ? ubo : ssbo;
+			}
+
+	}; // class frame_ring
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_FRAME_RING___
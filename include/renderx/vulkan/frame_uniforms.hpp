@@ -0,0 +1,308 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_FRAME_UNIFORMS___
+#define ___RENDERX_VULKAN_FRAME_UNIFORMS___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vk/functions.hpp"
+#include "engine/vk/utils.hpp"
+#include "engine/vulkan/device.hpp"
+#include "engine/vulkan/buffer.hpp"
+
+#include "renderx/vulkan/allocator.hpp"
+#include "renderx/vulkan/dirty_ranges.hpp"
+#include "renderx/memory/memcpy.hpp"
+
+#include <vector>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- F R A M E  U N I F O R M S ------------------------------------------
+
+	template <typename ___type>
+	class frame_uniforms final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* value type */
+			using value_type = ___type;
+
+			/* size type */
+			using size_type  = vk::device_size;
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::frame_uniforms<___type>;
+
+
+			// -- private members ---------------------------------------------
+
+			/* descriptor set layout (binding 0, uniform buffer) */
+			vk::descriptor_set_layout _layout;
+
+			/* descriptor pool */
+			vk::descriptor_pool _pool;
+
+			/* descriptor sets (one per slot) */
+			std::vector<vk::descriptor_set> _sets;
+
+			/* host allocator (shared, cached) */
+			vulkan::allocator<vulkan::cpu_cached>& _host;
+
+			/* written slots (flushed once per frame by the owner) */
+			vulkan::dirty_ranges& _dirty;
+
+			/* uniform buffer */
+			vulkan::buffer _buffer;
+
+			/* uniform allocation (persistently mapped) */
+			vulkan::allocation _memory;
+
+			/* slot stride */
+			size_type _stride;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			frame_uniforms(void) = delete;
+
+			/* host allocator / dirty ranges / slot count constructor (one slot per swapchain image) */
+			frame_uniforms(vulkan::allocator<vulkan::cpu_cached>& ___host,
+						   vulkan::dirty_ranges& ___dirty,
+						   const vk::u32& ___count)
+			: _layout{VK_NULL_HANDLE}, _pool{VK_NULL_HANDLE}, _sets{}, _host{___host}, _dirty{___dirty},
+			  _buffer{}, _memory{}, _stride{___self::_aligned_stride()} {
+
+				const auto& device = vulkan::device::logical();
+
+				// layout
+				const vk::descriptor_set_layout_binding binding {
+					.binding            = 0U,
+					.descriptorType     = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+					.descriptorCount    = 1U,
+					.stageFlags         = VK_SHADER_STAGE_VERTEX_BIT,
+					.pImmutableSamplers = nullptr
+				};
+
+				const vk::descriptor_set_layout_info layout_info {
+					.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+					.pNext        = nullptr,
+					.flags        = 0U,
+					.bindingCount = 1U,
+					.pBindings    = &binding
+				};
+
+				vk::try_execute<"failed to create descriptor set layout">(
+						::vk_create_descriptor_set_layout,
+						device, &layout_info, nullptr, &_layout);
+
+				// pool
+				const vk::descriptor_pool_size size {
+					.type            = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+					.descriptorCount = ___count
+				};
+
+				const vk::descriptor_pool_info pool_info {
+					.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+					.pNext         = nullptr,
+					.flags         = 0U,
+					.maxSets       = ___count,
+					.poolSizeCount = 1U,
+					.pPoolSizes    = &size
+				};
+
+				if (const auto result = ::vk_create_descriptor_pool(device, &pool_info, nullptr, &_pool);
+					result != VK_SUCCESS) {
+					::vk_destroy_descriptor_set_layout(device, _layout, nullptr);
+					throw vk::exception{"failed to create descriptor pool", result};
+				}
+
+				try {
+					___self::_allocate(___count);
+				}
+				catch (...) {
+					_host.free(_memory);
+					___self::_free();
+					throw;
+				}
+			}
+
+			/* deleted copy constructor */
+			frame_uniforms(const ___self&) = delete;
+
+			/* deleted move constructor */
+			frame_uniforms(___self&&) = delete;
+
+			/* destructor */
+			~frame_uniforms(void) noexcept {
+
+				_host.free(_memory);
+
+				___self::_free();
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* update (slot must not be read by a pending submission) */
+			auto update(const vk::u32& ___slot, const value_type& ___value) -> void {
+
+				rx::memcpy(static_cast<vk::u8*>(_memory.data) + (___slot * _stride), &___value, 1U);
+
+				// cached memory, visible once the owner flushes
+				_dirty.mark(_memory, ___slot * _stride, sizeof(value_type));
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* layout */
+			auto layout(void) const noexcept -> const vk::descriptor_set_layout& {
+				return _layout;
+			}
+
+			/* set */
+			auto set(const vk::u32& ___slot) const noexcept -> const vk::descriptor_set& {
+				return _sets[___slot];
+			}
+
+			/* count */
+			auto count(void) const noexcept -> vk::u32 {
+				return static_cast<vk::u32>(_sets.size());
+			}
+
+			/* buffer */
+			auto buffer(void) const noexcept -> const vk::buffer& {
+				return _buffer.underlying();
+			}
+
+			/* offset (of slot in buffer) */
+			auto offset(const vk::u32& ___slot) const noexcept -> size_type {
+				return ___slot * _stride;
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* allocate (sets, buffer and descriptor writes) */
+			auto _allocate(const vk::u32& ___count) -> void {
+
+				const auto& device = vulkan::device::logical();
+
+				_buffer = vulkan::buffer{_stride * ___count, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT};
+				_memory = _host.allocate_buffer(_buffer.underlying());
+
+				const std::vector<vk::descriptor_set_layout> layouts(___count, _layout);
+
+				_sets.resize(___count);
+
+				const vk::descriptor_set_allocate_info info {
+					.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+					.pNext              = nullptr,
+					.descriptorPool     = _pool,
+					.descriptorSetCount = ___count,
+					.pSetLayouts        = layouts.data()
+				};
+
+				vk::try_execute<"failed to allocate descriptor sets">(
+						::vk_allocate_descriptor_sets,
+						device, &info, _sets.data());
+
+				std::vector<vk::descriptor_buffer_info> buffers;
+				std::vector<vk::write_descriptor_set>   writes;
+
+				buffers.reserve(___count);
+				writes.reserve(___count);
+
+				// each set points at its own slot
+				for (vk::u32 i = 0U; i < ___count; ++i) {
+
+					buffers.push_back(vk::descriptor_buffer_info{
+						.buffer = _buffer.underlying(),
+						.offset = i * _stride,
+						.range  = sizeof(value_type)
+					});
+
+					writes.push_back(vk::write_descriptor_set{
+						.sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+						.pNext            = nullptr,
+						.dstSet           = _sets[i],
+						.dstBinding       = 0U,
+						.dstArrayElement  = 0U,
+						.descriptorCount  = 1U,
+						.descriptorType   = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+						.pImageInfo       = nullptr,
+						.pBufferInfo      = &buffers.back(),
+						.pTexelBufferView = nullptr
+					});
+				}
+
+				// single update for every set
+				::vk_update_descriptor_sets(device, ___count, writes.data(), 0U, nullptr);
+			}
+
+			/* free */
+			auto _free(void) noexcept -> void {
+
+				const auto& device = vulkan::device::logical();
+
+				// sets are released with their pool
+				::vk_destroy_descriptor_pool(device, _pool, nullptr);
+				::vk_destroy_descriptor_set_layout(device, _layout, nullptr);
+			}
+
+
+			// -- private static methods --------------------------------------
+
+			/* aligned stride */
+			static auto _aligned_stride(void) noexcept -> size_type {
+
+				const auto properties = vk::get_physical_device_properties(vulkan::device::physical());
+
+				const size_type ubo  = properties.limits.minUniformBufferOffsetAlignment;
+				const size_type atom = properties.limits.nonCoherentAtomSize;
+
+				// slots never share a flushed atom
+				const size_type align = ubo > atom ? ubo : atom;
+
+				return (sizeof(value_type) + align - 1U) & ~(align - 1U);
+			}
+
+	}; // class frame_uniforms
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_FRAME_UNIFORMS___
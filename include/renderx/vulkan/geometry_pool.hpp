@@ -0,0 +1,343 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_GEOMETRY_POOL___
+#define ___RENDERX_VULKAN_GEOMETRY_POOL___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vulkan/buffer.hpp"
+#include "engine/vulkan/command_buffer.hpp"
+
+#include "renderx/vulkan/allocator.hpp"
+#include "renderx/vulkan/uploader.hpp"
+#include "renderx/vulkan/defragmenter.hpp"
+#include "renderx/memory/virtual_block.hpp"
+#include "renderx/mesh.hpp"
+
+#include <stdexcept>
+#include <unordered_map>
+#include <cmath>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- G E O M E T R Y  P O O L --------------------------------------------
+
+	template <typename ___vertex, typename ___index>
+	class geometry_pool final {
+
+
+		// -- assertions ------------------------------------------------------
+
+		/* check for valid index type */
+		static_assert(xns::is_same<___index, vk::u16> || xns::is_same<___index, vk::u32>,
+				"geometry_pool: index type must be u16 or u32");
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* vertex type */
+			using vertex_type = ___vertex;
+
+			/* index type */
+			using index_type  = ___index;
+
+			/* size type */
+			using size_type   = vk::u32;
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::geometry_pool<___vertex, ___index>;
+
+
+			/* ranges (nodes of one mesh) */
+			struct ___ranges final {
+
+				/* vertex node */
+				rx::virtual_block::node_type vertex;
+
+				/* index node */
+				rx::virtual_block::node_type index;
+
+			}; // struct ___ranges
+
+
+			// -- private constants -------------------------------------------
+
+			/* transfer usage (upload target, defragmentation source) */
+			static constexpr vk::buffer_usage_flags ___TRANSFER___ = VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+																   | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+
+
+			// -- private members ---------------------------------------------
+
+			/* allocator */
+			vulkan::allocator<vulkan::gpu>& _allocator;
+
+			/* defragmenter (relocates and resizes both buffers) */
+			vulkan::defragmenter<vulkan::gpu>& _defrag;
+
+			/* vertex buffer */
+			vulkan::buffer _vertices;
+
+			/* index buffer */
+			vulkan::buffer _indices;
+
+			/* vertex memory */
+			vulkan::allocation _vertex_memory;
+
+			/* index memory */
+			vulkan::allocation _index_memory;
+
+			/* vertex ranges (in vertices) */
+			rx::virtual_block _vertex_ranges;
+
+			/* index ranges (in indices) */
+			rx::virtual_block _index_ranges;
+
+			/* meshes (by first index) */
+			std::unordered_map<size_type, ___ranges> _meshes;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			geometry_pool(void) = delete;
+
+			/* allocator / defragmenter / initial capacities constructor */
+			geometry_pool(vulkan::allocator<vulkan::gpu>& ___allocator,
+						  vulkan::defragmenter<vulkan::gpu>& ___defrag,
+						  const size_type& ___vertex_capacity,
+						  const size_type& ___index_capacity)
+			: _allocator{___allocator},
+			  _defrag{___defrag},
+			  _vertices{sizeof(vertex_type) * static_cast<vk::device_size>(___vertex_capacity),
+						VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | ___self::___TRANSFER___},
+			  _indices{sizeof(index_type) * static_cast<vk::device_size>(___index_capacity),
+						VK_BUFFER_USAGE_INDEX_BUFFER_BIT | ___self::___TRANSFER___},
+			  _vertex_memory{_allocator.allocate_buffer(_vertices.underlying())},
+			  _index_memory{_allocator.allocate_buffer(_indices.underlying())},
+			  _vertex_ranges{___vertex_capacity},
+			  _index_ranges{___index_capacity},
+			  _meshes{} {
+
+				// both buffers may be relocated out of sparse blocks
+				_defrag.track(_vertices, _vertex_memory);
+				_defrag.track(_indices,  _index_memory);
+			}
+
+			/* deleted copy constructor */
+			geometry_pool(const ___self&) = delete;
+
+			/* deleted move constructor */
+			geometry_pool(___self&&) = delete;
+
+			/* destructor */
+			~geometry_pool(void) noexcept {
+
+				_defrag.untrack(_indices);
+				_defrag.untrack(_vertices);
+
+				// return ranges to allocator
+				_allocator.free(_index_memory);
+				_allocator.free(_vertex_memory);
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* add (buffers grow when full, recorded binds are stale afterwards) */
+			auto add(vulkan::uploader& ___uploader,
+					 const vk::vector<vertex_type>& ___vertices,
+					 const vk::vector<index_type>& ___indices) -> rx::mesh {
+
+				const auto vcount = static_cast<size_type>(___vertices.size());
+				const auto icount = static_cast<size_type>(___indices.size());
+
+				if (vcount == 0U || icount == 0U)
+					throw std::runtime_error("geometry pool: empty mesh");
+
+				// a pass in flight still copies into the buffers written below
+				_defrag.wait();
+
+				rx::virtual_block::range vertex;
+				rx::virtual_block::range index;
+
+				___self::_allocate(_vertices, _vertex_memory, _vertex_ranges,
+								   sizeof(vertex_type), vcount, vertex);
+
+				try {
+					___self::_allocate(_indices, _index_memory, _index_ranges,
+									   sizeof(index_type), icount, index);
+				}
+				catch (...) {
+					_vertex_ranges.free(vertex.node);
+					throw;
+				}
+
+				// stage into sub-ranges of the shared buffers
+				___uploader.upload(_vertices.underlying(), ___vertices.data(), vcount,
+						sizeof(vertex_type) * static_cast<vk::device_size>(vertex.offset));
+
+				___uploader.upload(_indices.underlying(), ___indices.data(), icount,
+						sizeof(index_type) * static_cast<vk::device_size>(index.offset));
+
+				// indices stay local, vertex offset rebases them
+				const rx::mesh mesh{static_cast<vk::i32>(vertex.offset),
+									static_cast<vk::u32>(index.offset), icount,
+									___self::_radius(___vertices)};
+
+				_meshes.emplace(mesh.first_index(), ___ranges{vertex.node, index.node});
+
+				return mesh;
+			}
+
+			/* remove (no pending submission may draw the mesh) */
+			auto remove(const rx::mesh& ___mesh) -> void {
+
+				const auto it = _meshes.find(___mesh.first_index());
+
+				if (it == _meshes.end())
+					throw std::runtime_error("geometry pool: unknown mesh");
+
+				// ranges are reused by later meshes
+				_vertex_ranges.free(it->second.vertex);
+				_index_ranges.free(it->second.index);
+
+				_meshes.erase(it);
+			}
+
+			/* bind (command buffer or state tracker) */
+			template <typename ___encoder>
+			auto bind(___encoder& ___cmd) const noexcept -> void {
+
+				// one bind for every mesh of the pool
+				___cmd.bind_vertex_buffer(_vertices.underlying());
+				___cmd.bind_index_buffer(_indices.underlying(), ___self::index_type_of());
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* vertex count (in use) */
+			auto vertex_count(void) const noexcept -> size_type {
+				return static_cast<size_type>(_vertex_ranges.used());
+			}
+
+			/* index count (in use) */
+			auto index_count(void) const noexcept -> size_type {
+				return static_cast<size_type>(_index_ranges.used());
+			}
+
+			/* mesh count */
+			auto mesh_count(void) const noexcept -> size_type {
+				return static_cast<size_type>(_meshes.size());
+			}
+
+			/* vertices */
+			auto vertices(void) const noexcept -> const vk::buffer& {
+				return _vertices.underlying();
+			}
+
+			/* indices */
+			auto indices(void) const noexcept -> const vk::buffer& {
+				return _indices.underlying();
+			}
+
+
+			// -- public static methods ---------------------------------------
+
+			/* index type of */
+			static constexpr auto index_type_of(void) noexcept -> vk::index_type {
+				if constexpr (xns::is_same<___index, vk::u16>)
+					return VK_INDEX_TYPE_UINT16;
+				else
+					return VK_INDEX_TYPE_UINT32;
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* allocate (range of ___count elements, buffer grows when full) */
+			auto _allocate(vulkan::buffer& ___buffer,
+						   vulkan::allocation& ___alloc,
+						   rx::virtual_block& ___block,
+						   const vk::device_size& ___stride,
+						   const size_type& ___count,
+						   rx::virtual_block::range& ___rg) -> void {
+
+				if (___block.allocate(___count, 1U, ___rg) == true)
+					return;
+
+				const auto size = ___block.size();
+
+				// doubled, or enough for a request larger than the pool
+				const auto capacity = size + (___count > size ? ___count : size);
+
+				// mesh offsets are 32 bits wide
+				if (capacity > static_cast<rx::virtual_block::size_type>(INT32_MAX))
+					throw std::runtime_error("geometry pool out of memory");
+
+				// copied into a larger buffer, free tail joins the new space
+				_defrag.resize(___buffer, ___alloc, ___stride * capacity);
+				___block.grow(capacity);
+
+				if (___block.allocate(___count, 1U, ___rg) == false)
+					throw std::runtime_error("geometry pool out of memory");
+			}
+
+
+			// -- private static methods --------------------------------------
+
+			/* radius (farthest vertex from origin, first attribute is the position) */
+			static auto _radius(const vk::vector<vertex_type>& ___vertices) noexcept -> float {
+
+				float squared = 0.0f;
+
+				for (const auto& vertex : ___vertices) {
+
+					const auto& p = vertex.template get<0U>();
+
+					const float d = (p.x() * p.x()) + (p.y() * p.y()) + (p.z() * p.z());
+
+					if (d > squared)
+						squared = d;
+				}
+
+				return std::sqrt(squared);
+			}
+
+	}; // class geometry_pool
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_GEOMETRY_POOL___
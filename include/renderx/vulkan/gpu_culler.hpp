@@ -0,0 +1,588 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_GPU_CULLER___
+#define ___RENDERX_VULKAN_GPU_CULLER___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vk/utils.hpp"
+#include "engine/vulkan/device.hpp"
+#include "engine/vulkan/buffer.hpp"
+#include "engine/vulkan/command_buffer.hpp"
+#include "engine/vulkan/pipeline_cache.hpp"
+#include "engine/shader_library.hpp"
+
+#include "renderx/vulkan/allocator.hpp"
+#include "renderx/vulkan/frame_uniforms.hpp"
+#include "renderx/memory/memcpy.hpp"
+#include "renderx/object.hpp"
+
+#include <glm/glm.hpp>
+#include <vector>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- G P U  C U L L E R --------------------------------------------------
+
+	class gpu_culler final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* size type */
+			using size_type = vk::u32;
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::gpu_culler;
+
+
+			/* object (std430 layout of cull.glsl) */
+			struct ___object final {
+
+				/* model matrix */
+				glm::mat4 model;
+
+				/* bounding sphere (model space center, radius) */
+				glm::vec4 sphere;
+
+				/* index count */
+				vk::u32 index_count;
+
+				/* first index */
+				vk::u32 first_index;
+
+				/* vertex offset */
+				vk::i32 vertex_offset;
+
+				/* padding */
+				vk::u32 padding;
+
+			}; // struct ___object
+
+			static_assert(sizeof(___object) == 96U, "object must match the std430 layout of cull.glsl");
+
+
+			/* push constants */
+			struct ___constants final {
+
+				/* object count */
+				vk::u32 object_count;
+
+				/* compact visible draws (draw count read from gpu) */
+				vk::u32 compact;
+
+			}; // struct ___constants
+
+
+			/* slot (culling buffers of one swapchain image) */
+			struct ___slot final {
+
+				/* objects (host written) */
+				vulkan::buffer objects;
+
+				/* objects memory (persistently mapped) */
+				vulkan::allocation objects_memory;
+
+				/* indirect commands */
+				vulkan::buffer commands;
+
+				/* commands memory */
+				vulkan::allocation commands_memory;
+
+				/* draw count */
+				vulkan::buffer count;
+
+				/* count memory */
+				vulkan::allocation count_memory;
+
+				/* visible model matrices (instance stream) */
+				vulkan::buffer instances;
+
+				/* instances memory */
+				vulkan::allocation instances_memory;
+
+				/* descriptor set */
+				vk::descriptor_set set;
+
+				/* capacity (objects) */
+				size_type capacity;
+
+				/* uploaded objects */
+				size_type size;
+
+			}; // struct ___slot
+
+
+			// -- private constants -------------------------------------------
+
+			enum : vk::u32 {
+				/* compute work group size (local_size_x of cull.glsl) */
+				___GROUP_SIZE___   = 64U,
+				/* smallest object buffer */
+				___MIN_CAPACITY___ = 256U,
+				/* storage bindings (objects, commands, count, instances) */
+				___STORAGES___     = 4U,
+				/* bindings (camera + storages) */
+				___BINDINGS___     = ___STORAGES___ + 1U
+			};
+
+
+			// -- private members ---------------------------------------------
+
+			/* device local allocator */
+			vulkan::allocator<vulkan::gpu>& _allocator;
+
+			/* host allocator (shared) */
+			vulkan::allocator<vulkan::cpu_coherent>& _host;
+
+			/* camera uniforms */
+			const vulkan::frame_uniforms<glm::mat4>& _camera;
+
+			/* descriptor set layout */
+			vk::descriptor_set_layout _set_layout;
+
+			/* descriptor pool */
+			vk::descriptor_pool _pool;
+
+			/* pipeline layout */
+			vk::pipeline_layout _layout;
+
+			/* compute pipeline */
+			vk::pipeline _pipeline;
+
+			/* slots */
+			std::vector<___slot> _slots;
+
+			/* culling available (shader and first instance feature) */
+			bool _supported;
+
+			/* compact draws with a gpu draw count */
+			bool _compact;
+
+			/* multi draw indirect feature */
+			bool _multi_draw;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			gpu_culler(void) = delete;
+
+			/* shaders / allocators / camera constructor (one slot per camera slot) */
+			gpu_culler(const engine::shader_library& ___shaders,
+					   vulkan::allocator<vulkan::gpu>& ___allocator,
+					   vulkan::allocator<vulkan::cpu_coherent>& ___host,
+					   const vulkan::frame_uniforms<glm::mat4>& ___camera)
+			: _allocator{___allocator}, _host{___host}, _camera{___camera},
+			  _set_layout{VK_NULL_HANDLE}, _pool{VK_NULL_HANDLE},
+			  _layout{VK_NULL_HANDLE}, _pipeline{VK_NULL_HANDLE},
+			  _slots(___camera.count()),
+			  _supported{false}, _compact{false}, _multi_draw{false} {
+
+				const auto features = vulkan::device::physical().features();
+
+				// first instance addresses the instance stream of each draw
+				_supported  = features.drawIndirectFirstInstance == VK_TRUE
+						   && ___shaders.has_compute_module("cull") == true;
+				_compact    = vulkan::device::draw_indirect_count();
+				_multi_draw = features.multiDrawIndirect == VK_TRUE;
+
+				// renderer keeps the cpu path
+				if (_supported == false)
+					return;
+
+				try {
+					___self::_create(___shaders.compute_module("cull"));
+				}
+				catch (...) {
+					___self::_free();
+					throw;
+				}
+			}
+
+			/* deleted copy constructor */
+			gpu_culler(const ___self&) = delete;
+
+			/* deleted move constructor */
+			gpu_culler(___self&&) = delete;
+
+			/* destructor */
+			~gpu_culler(void) noexcept {
+
+				for (auto& slot : _slots) {
+					_host.free(slot.objects_memory);
+					_allocator.free(slot.commands_memory);
+					_allocator.free(slot.count_memory);
+					_allocator.free(slot.instances_memory);
+				}
+
+				___self::_free();
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* upload (slot must not be read by a pending submission) */
+			auto upload(const vk::u32& ___index, const vk::vector<rx::object>& ___objects) -> void {
+
+				___slot& slot = _slots[___index];
+
+				const auto count = static_cast<size_type>(___objects.size());
+
+				if (count > slot.capacity)
+					___self::_grow(___index, count);
+
+				auto* dst = static_cast<___object*>(slot.objects_memory.data);
+
+				for (size_type i = 0U; i < count; ++i) {
+
+					const rx::object& object = ___objects[i];
+					const rx::mesh&   mesh   = object.mesh();
+
+					const ___object value {
+						.model         = object.model(),
+						.sphere        = glm::vec4{0.0f, 0.0f, 0.0f, mesh.radius()},
+						.index_count   = mesh.index_count(),
+						.first_index   = mesh.first_index(),
+						.vertex_offset = mesh.vertex_offset(),
+						.padding       = 0U
+					};
+
+					// coherent memory, visible at next submission
+					rx::memcpy(dst + i, &value, 1U);
+				}
+
+				slot.size = count;
+			}
+
+			/* cull (outside of a render pass) */
+			template <typename ___type>
+			auto cull(const vulkan::command_buffer<___type>& ___cmd, const vk::u32& ___index) const noexcept -> void {
+
+				const ___slot& slot = _slots[___index];
+
+				if (slot.size == 0U)
+					return;
+
+				// reset draw count
+				___cmd.fill_buffer(slot.count.underlying(), 0U, sizeof(vk::u32), 0U);
+
+				___cmd.memory_barrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+									  VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+									  VK_ACCESS_TRANSFER_WRITE_BIT,
+									  VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+
+				___cmd.bind_pipeline(_pipeline, VK_PIPELINE_BIND_POINT_COMPUTE);
+				___cmd.bind_descriptor_set(_layout, slot.set, VK_PIPELINE_BIND_POINT_COMPUTE);
+				___cmd.push_constants(_layout, VK_SHADER_STAGE_COMPUTE_BIT,
+						___constants{slot.size, _compact == true ? 1U : 0U});
+
+				___cmd.dispatch((slot.size + ___GROUP_SIZE___ - 1U) / ___GROUP_SIZE___);
+
+				// commands and instances consumed by the following draws
+				___cmd.memory_barrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+									  VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+									  VK_ACCESS_SHADER_WRITE_BIT,
+									  VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT);
+			}
+
+			/* bind (instance stream of slot) */
+			template <typename ___encoder>
+			auto bind(___encoder& ___cmd, const vk::u32& ___index,
+					  const vk::u32 ___binding = 1U) const noexcept -> void {
+				___cmd.bind_vertex_buffer(_slots[___index].instances.underlying(), ___binding);
+			}
+
+			/* draw (inside a render pass, geometry and pipeline bound) */
+			template <typename ___type>
+			auto draw(const vulkan::command_buffer<___type>& ___cmd, const vk::u32& ___index) const noexcept -> void {
+
+				const ___slot& slot = _slots[___index];
+
+				if (slot.size == 0U)
+					return;
+
+				// visible draws packed, count written by the gpu
+				if (_compact == true) {
+					___cmd.draw_indexed_indirect_count(slot.commands.underlying(), 0U,
+													   slot.count.underlying(), 0U, slot.size);
+					return;
+				}
+
+				// culled draws carry no instance
+				if (_multi_draw == true) {
+					___cmd.draw_indexed_indirect(slot.commands.underlying(), 0U, slot.size);
+					return;
+				}
+
+				for (size_type i = 0U; i < slot.size; ++i)
+					___cmd.draw_indexed_indirect(slot.commands.underlying(),
+							i * sizeof(vk::draw_indexed_indirect_command), 1U);
+			}
+
+			/* rebuild (reloaded cull module, no pending submission may use the pipeline) */
+			auto rebuild(const engine::shader_library& ___shaders) -> void {
+
+				if (_supported == false)
+					return;
+
+				// previous pipeline stays in use if compilation fails
+				const vk::pipeline pipeline = ___self::_compile(___shaders.compute_module("cull"));
+
+				::vk_destroy_pipeline(vulkan::device::logical(), _pipeline, nullptr);
+
+				_pipeline = pipeline;
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* supported */
+			auto supported(void) const noexcept -> bool {
+				return _supported;
+			}
+
+			/* compact (gpu draw count in use) */
+			auto compact(void) const noexcept -> bool {
+				return _compact;
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* create (layouts, pool, sets and pipeline) */
+			auto _create(const vulkan::compute_module& ___module) -> void {
+
+				const auto& device = vulkan::device::logical();
+
+				// layout
+				vk::descriptor_set_layout_binding bindings[___BINDINGS___];
+
+				for (vk::u32 i = 0U; i < ___BINDINGS___; ++i) {
+					bindings[i] = vk::descriptor_set_layout_binding{
+						.binding            = i,
+						.descriptorType     = i == 0U ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+													  : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+						.descriptorCount    = 1U,
+						.stageFlags         = VK_SHADER_STAGE_COMPUTE_BIT,
+						.pImmutableSamplers = nullptr
+					};
+				}
+
+				const vk::descriptor_set_layout_info set_layout_info {
+					.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+					.pNext        = nullptr,
+					.flags        = 0U,
+					.bindingCount = ___BINDINGS___,
+					.pBindings    = bindings
+				};
+
+				vk::try_execute<"failed to create descriptor set layout">(
+						::vk_create_descriptor_set_layout,
+						device, &set_layout_info, nullptr, &_set_layout);
+
+				// pool
+				const auto count = static_cast<vk::u32>(_slots.size());
+
+				const vk::descriptor_pool_size sizes[2U] {
+					{ .type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = count },
+					{ .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .descriptorCount = count * ___STORAGES___ }
+				};
+
+				const vk::descriptor_pool_info pool_info {
+					.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+					.pNext         = nullptr,
+					.flags         = 0U,
+					.maxSets       = count,
+					.poolSizeCount = 2U,
+					.pPoolSizes    = sizes
+				};
+
+				vk::try_execute<"failed to create descriptor pool">(
+						::vk_create_descriptor_pool,
+						device, &pool_info, nullptr, &_pool);
+
+				// sets
+				const std::vector<vk::descriptor_set_layout> layouts(count, _set_layout);
+				std::vector<vk::descriptor_set> sets(count, VK_NULL_HANDLE);
+
+				const vk::descriptor_set_allocate_info allocate_info {
+					.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+					.pNext              = nullptr,
+					.descriptorPool     = _pool,
+					.descriptorSetCount = count,
+					.pSetLayouts        = layouts.data()
+				};
+
+				vk::try_execute<"failed to allocate descriptor sets">(
+						::vk_allocate_descriptor_sets,
+						device, &allocate_info, sets.data());
+
+				for (vk::u32 i = 0U; i < count; ++i)
+					_slots[i].set = sets[i];
+
+				// pipeline layout
+				const vk::push_constant_range range {
+					.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+					.offset     = 0U,
+					.size       = sizeof(___constants)
+				};
+
+				const vk::pipeline_layout_info layout_info {
+					.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+					.pNext                  = nullptr,
+					.flags                  = 0U,
+					.setLayoutCount         = 1U,
+					.pSetLayouts            = &_set_layout,
+					.pushConstantRangeCount = 1U,
+					.pPushConstantRanges    = &range
+				};
+
+				vk::try_execute<"failed to create pipeline layout">(
+						::vk_create_pipeline_layout,
+						device, &layout_info, nullptr, &_layout);
+
+				// pipeline
+				_pipeline = ___self::_compile(___module);
+			}
+
+			/* compile (compute pipeline on current layout) */
+			auto _compile(const vulkan::compute_module& ___module) const -> vk::pipeline {
+
+				const vk::compute_pipeline_info pipeline_info {
+					.sType              = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+					.pNext              = nullptr,
+					.flags              = 0U,
+					.stage              = ___module.stage_info(),
+					.layout             = _layout,
+					.basePipelineHandle = VK_NULL_HANDLE,
+					.basePipelineIndex  = -1
+				};
+
+				vk::pipeline pipeline = VK_NULL_HANDLE;
+
+				vk::try_execute<"failed to create compute pipeline">(
+						::vk_create_compute_pipelines,
+						vulkan::device::logical(), vulkan::pipeline_cache::underlying(),
+						1U, &pipeline_info, nullptr, &pipeline);
+
+				return pipeline;
+			}
+
+			/* grow (power of two capacity, buffers and descriptors of slot) */
+			auto _grow(const vk::u32& ___index, const size_type& ___count) -> void {
+
+				___slot& slot = _slots[___index];
+
+				size_type capacity = ___MIN_CAPACITY___;
+
+				while (capacity < ___count)
+					capacity <<= 1U;
+
+				// previous submission of this slot is done
+				_host.free(slot.objects_memory);
+				_allocator.free(slot.commands_memory);
+				_allocator.free(slot.instances_memory);
+
+				const auto objects   = sizeof(___object)                        * static_cast<vk::device_size>(capacity);
+				const auto commands  = sizeof(vk::draw_indexed_indirect_command) * static_cast<vk::device_size>(capacity);
+				const auto instances = sizeof(glm::mat4)                        * static_cast<vk::device_size>(capacity);
+
+				slot.objects          = vulkan::buffer{objects, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT};
+				slot.objects_memory   = _host.allocate_buffer(slot.objects.underlying());
+
+				slot.commands         = vulkan::buffer{commands, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+															   | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT};
+				slot.commands_memory  = _allocator.allocate_buffer(slot.commands.underlying());
+
+				slot.instances        = vulkan::buffer{instances, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+																 | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT};
+				slot.instances_memory = _allocator.allocate_buffer(slot.instances.underlying());
+
+				// count never grows
+				if (slot.capacity == 0U) {
+					slot.count        = vulkan::buffer{sizeof(vk::u32), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+																	  | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT
+																	  | VK_BUFFER_USAGE_TRANSFER_DST_BIT};
+					slot.count_memory = _allocator.allocate_buffer(slot.count.underlying());
+				}
+
+				slot.capacity = capacity;
+
+				const vk::descriptor_buffer_info buffers[___BINDINGS___] {
+					{ .buffer = _camera.buffer(),            .offset = _camera.offset(___index), .range = sizeof(glm::mat4) },
+					{ .buffer = slot.objects.underlying(),   .offset = 0U, .range = VK_WHOLE_SIZE },
+					{ .buffer = slot.commands.underlying(),  .offset = 0U, .range = VK_WHOLE_SIZE },
+					{ .buffer = slot.count.underlying(),     .offset = 0U, .range = VK_WHOLE_SIZE },
+					{ .buffer = slot.instances.underlying(), .offset = 0U, .range = VK_WHOLE_SIZE }
+				};
+
+				vk::write_descriptor_set writes[___BINDINGS___];
+
+				for (vk::u32 i = 0U; i < ___BINDINGS___; ++i) {
+					writes[i] = vk::write_descriptor_set{
+						.sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+						.pNext            = nullptr,
+						.dstSet           = slot.set,
+						.dstBinding       = i,
+						.dstArrayElement  = 0U,
+						.descriptorCount  = 1U,
+						.descriptorType   = i == 0U ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+												  : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+						.pImageInfo       = nullptr,
+						.pBufferInfo      = &buffers[i],
+						.pTexelBufferView = nullptr
+					};
+				}
+
+				::vk_update_descriptor_sets(vulkan::device::logical(), ___BINDINGS___, writes, 0U, nullptr);
+			}
+
+			/* free */
+			auto _free(void) noexcept -> void {
+
+				const auto& device = vulkan::device::logical();
+
+				// null handles are ignored, sets are released with their pool
+				::vk_destroy_pipeline(device, _pipeline, nullptr);
+				::vk_destroy_pipeline_layout(device, _layout, nullptr);
+				::vk_destroy_descriptor_pool(device, _pool, nullptr);
+				::vk_destroy_descriptor_set_layout(device, _set_layout, nullptr);
+			}
+
+	}; // class gpu_culler
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_GPU_CULLER___
@@ -55,14 +55,14 @@ namespace vulkan {
 
 			/* u16 vector constructor */
 			index_buffer(const vk::vector<rx::u16>& indices)
-			: _buffer(sizeof(rx::u16) * indices.size(), VK_BUFFER_USAGE_INDEX_BUFFER_BIT),
+			: _buffer(sizeof(rx::u16) * indices.size(), VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT),
 			  _type{VK_INDEX_TYPE_UINT16},
 			  _count((vk::u32)indices.size()) {
 			}
 
 			/* u32 vector constructor */
 			index_buffer(const vk::vector<rx::u32>& indices)
-			: _buffer(sizeof(rx::u32) * indices.size(), VK_BUFFER_USAGE_INDEX_BUFFER_BIT),
+			: _buffer(sizeof(rx::u32) * indices.size(), VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT),
 			  _type{VK_INDEX_TYPE_UINT32},
 			  _count((vk::u32)indices.size()) {
 			}
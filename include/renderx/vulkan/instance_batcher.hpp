@@ -0,0 +1,260 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_INSTANCE_BATCHER___
+#define ___RENDERX_VULKAN_INSTANCE_BATCHER___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vulkan/buffer.hpp"
+
+#include "renderx/vulkan/allocator.hpp"
+#include "renderx/vulkan/frame_ring.hpp"
+#include "renderx/memory/memcpy.hpp"
+#include "renderx/mesh.hpp"
+
+#include <vector>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- I N S T A N C E  B A T C H E R --------------------------------------
+
+	template <typename ___instance>
+	class instance_batcher final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* value type */
+			using value_type = ___instance;
+
+			/* size type */
+			using size_type  = vk::u32;
+
+
+			// -- public structs ----------------------------------------------
+
+			/* batch (one instanced draw) */
+			struct batch final {
+
+				/* mesh */
+				const rx::mesh* mesh;
+
+				/* first instance */
+				size_type first;
+
+				/* instance count */
+				size_type count;
+
+			}; // struct batch
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::instance_batcher<___instance>;
+
+
+			/* slot (per-instance stream of one swapchain image) */
+			struct ___slot final {
+
+				/* instance buffer */
+				vulkan::buffer buffer;
+
+				/* instance memory (persistently mapped) */
+				vulkan::allocation memory;
+
+				/* capacity (instances) */
+				size_type capacity;
+
+			}; // struct ___slot
+
+
+			// -- private constants -------------------------------------------
+
+			enum : size_type {
+				/* smallest instance buffer */
+				___MIN_CAPACITY___ = 256U
+			};
+
+
+			// -- private members ---------------------------------------------
+
+			/* host allocator (shared) */
+			vulkan::allocator<vulkan::cpu_coherent>& _host;
+
+			/* slots */
+			std::vector<___slot> _slots;
+
+			/* batches of current build */
+			std::vector<batch> _batches;
+
+			/* current stream (slot buffer or ring buffer) */
+			vk::buffer _stream;
+
+			/* current stream offset (bytes) */
+			vk::device_size _offset;
+
+			/* current stream data (mapped) */
+			value_type* _data;
+
+			/* instances written */
+			size_type _count;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			instance_batcher(void) = delete;
+
+			/* host allocator / slot count constructor (one slot per swapchain image) */
+			instance_batcher(vulkan::allocator<vulkan::cpu_coherent>& ___host,
+							 const size_type& ___slots)
+			: _host{___host}, _slots(___slots), _batches{},
+			  _stream{VK_NULL_HANDLE}, _offset{0U}, _data{nullptr}, _count{0U} {
+			}
+
+			/* deleted copy constructor */
+			instance_batcher(const ___self&) = delete;
+
+			/* deleted move constructor */
+			instance_batcher(___self&&) = delete;
+
+			/* destructor */
+			~instance_batcher(void) noexcept {
+
+				for (auto& slot : _slots)
+					_host.free(slot.memory);
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* begin (slot must not be read by a pending submission) */
+			auto begin(const size_type& ___slot, const size_type& ___count) -> void {
+
+				auto& slot = _slots[___slot];
+
+				if (___count > slot.capacity)
+					___self::_grow(slot, ___count);
+
+				// retained stream, replayed until the image is re-recorded
+				___self::_begin(slot.buffer.underlying(), 0U, slot.memory.data);
+			}
+
+			/* begin (ring slice of current frame, commands must be recorded every frame) */
+			template <typename ___memory>
+			auto begin(vulkan::frame_ring<___memory>& ___ring, const size_type& ___count) -> void {
+
+				const auto sl = ___ring.allocate(sizeof(value_type) * static_cast<vk::device_size>(___count),
+												 alignof(value_type));
+
+				___self::_begin(___ring.underlying(), sl.offset, sl.data);
+			}
+
+			/* push (merged with previous batch when the mesh is the same) */
+			auto push(const rx::mesh& ___mesh, const value_type& ___value) noexcept -> void {
+
+				rx::memcpy(_data + _count, &___value, 1U);
+
+				// sorted input, same meshes are adjacent
+				if (_batches.empty() == false
+				 && ___self::_same(*_batches.back().mesh, ___mesh) == true)
+					++_batches.back().count;
+				else
+					_batches.push_back(batch{&___mesh, _count, 1U});
+
+				++_count;
+			}
+
+			/* bind (current per-instance stream) */
+			template <typename ___encoder>
+			auto bind(___encoder& ___cmd, const vk::u32 ___binding = 1U) const noexcept -> void {
+				___cmd.bind_vertex_buffer(_stream, ___binding, _offset);
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* batches */
+			auto batches(void) const noexcept -> const std::vector<batch>& {
+				return _batches;
+			}
+
+			/* instances */
+			auto instances(void) const noexcept -> size_type {
+				return _count;
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* begin (start a build on stream) */
+			auto _begin(const vk::buffer& ___stream, const vk::device_size& ___offset, void* ___data) noexcept -> void {
+
+				_stream = ___stream;
+				_offset = ___offset;
+				_data   = static_cast<value_type*>(___data);
+				_count  = 0U;
+				_batches.clear();
+			}
+
+			/* grow (power of two capacity) */
+			auto _grow(___slot& ___slot, const size_type& ___count) -> void {
+
+				size_type capacity = ___MIN_CAPACITY___;
+
+				while (capacity < ___count)
+					capacity <<= 1U;
+
+				// previous submission of this slot is done
+				_host.free(___slot.memory);
+
+				___slot.buffer   = vulkan::buffer{sizeof(value_type) * static_cast<vk::device_size>(capacity),
+												  VK_BUFFER_USAGE_VERTEX_BUFFER_BIT};
+				___slot.memory   = _host.allocate_buffer(___slot.buffer.underlying());
+				___slot.capacity = capacity;
+			}
+
+
+			// -- private static methods --------------------------------------
+
+			/* same mesh */
+			static auto _same(const rx::mesh& ___a, const rx::mesh& ___b) noexcept -> bool {
+				return ___a.first_index()   == ___b.first_index()
+					&& ___a.index_count()   == ___b.index_count()
+					&& ___a.vertex_offset() == ___b.vertex_offset();
+			}
+
+	}; // class instance_batcher
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_INSTANCE_BATCHER___
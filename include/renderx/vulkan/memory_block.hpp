@@ -0,0 +1,265 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_MEMORY_BLOCK___
+#define ___RENDERX_VULKAN_MEMORY_BLOCK___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vulkan/device.hpp"
+#include "engine/vk/utils.hpp"
+#include "renderx/hint.hpp"
+#include "renderx/memory/virtual_block.hpp"
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- M E M O R Y  B L O C K ----------------------------------------------
+
+	class memory_block final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* size type */
+			using size_type = vk::device_size;
+
+			/* node type */
+			using node_type = rx::virtual_block::node_type;
+
+			/* range type */
+			using range     = rx::virtual_block::range;
+
+
+			// -- public constants --------------------------------------------
+
+			/* null node */
+			enum : node_type {
+				NIL = rx::virtual_block::NIL
+			};
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::memory_block;
+
+
+			// -- private members ---------------------------------------------
+
+			/* memory */
+			vk::device_memory _memory;
+
+			/* size */
+			size_type _size;
+
+			/* memory type */
+			vk::u32 _type;
+
+			/* mapped pointer (host visible only) */
+			void* _mapped;
+
+			/* range bookkeeping */
+			rx::virtual_block _block;
+
+			/* idle timestamp */
+			vk::u64 _idle;
+
+			/* dedicated to a single resource */
+			bool _dedicated;
+
+			/* host coherent (no flush needed) */
+			bool _coherent;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			memory_block(void) = delete;
+
+			/* memory type / size / properties constructor */
+			memory_block(const vk::u32& ___type, const size_type& ___size,
+						 const vk::memory_property_flags& ___flags,
+						 const vk::buffer& ___dedicated = VK_NULL_HANDLE)
+			: /* uninitialized device memory */ _size{___size}, _type{___type},
+			  _mapped{nullptr}, _block{___size}, _idle{0U},
+			  _dedicated{___dedicated != VK_NULL_HANDLE},
+			  _coherent{(___flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0U} {
+
+				// dedicated info (memory bound to a single buffer)
+				const vk::memory_dedicated_allocate_info dedicated {
+					// structure type
+					VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO,
+					// next structure
+					nullptr,
+					// image
+					VK_NULL_HANDLE,
+					// buffer
+					___dedicated
+				};
+
+				// create info
+				const vk::memory_allocate_info info {
+					// structure type
+					VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+					// next structure
+					_dedicated ? &dedicated : nullptr,
+					// allocation size
+					___size,
+					// memory type index
+					___type
+				};
+
+				// create device memory
+				vk::try_execute<"failed to allocate memory">(
+						::vk_allocate_memory,
+						vulkan::device::logical(), &info, nullptr, &_memory);
+
+				// map host visible memory once for the block lifetime
+				if ((___flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0U) {
+
+					const auto result = ::vk_map_memory(vulkan::device::logical(),
+							_memory, 0U, VK_WHOLE_SIZE, 0U /* reserved */, &_mapped);
+
+					if (result != VK_SUCCESS) {
+						::vk_free_memory(vulkan::device::logical(), _memory, nullptr);
+						throw vk::exception{"failed to map memory", result};
+					}
+				}
+
+				if (_dedicated == true)
+					rx::hint::success("new dedicated memory allocated");
+				else
+					rx::hint::success("new memory block allocated");
+			}
+
+			/* deleted copy constructor */
+			memory_block(const ___self&) = delete;
+
+			/* deleted move constructor */
+			memory_block(___self&&) = delete;
+
+			/* destructor */
+			~memory_block(void) noexcept {
+
+				// unmap memory
+				if (_mapped != nullptr)
+					::vk_unmap_memory(vulkan::device::logical(), _memory);
+
+				// release device memory
+				::vk_free_memory(
+						vulkan::device::logical(), _memory, nullptr);
+
+				rx::hint::info("memory block released");
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* allocate */
+			auto allocate(const size_type& ___sz, const size_type& ___align, range& ___rg) -> bool {
+				return _block.allocate(___sz, ___align, ___rg);
+			}
+
+			/* free */
+			auto free(const node_type ___n) -> void {
+				_block.free(___n);
+			}
+
+			/* reset */
+			auto reset(void) -> void {
+				_block.reset();
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* memory */
+			auto memory(void) const noexcept -> const vk::device_memory& {
+				return _memory;
+			}
+
+			/* mapped */
+			auto mapped(void) const noexcept -> void* {
+				return _mapped;
+			}
+
+			/* size */
+			auto size(void) const noexcept -> size_type {
+				return _size;
+			}
+
+			/* used */
+			auto used(void) const noexcept -> size_type {
+				return _block.used();
+			}
+
+			/* count */
+			auto count(void) const noexcept -> vk::u32 {
+				return _block.count();
+			}
+
+			/* largest free range */
+			auto largest_free(void) const noexcept -> size_type {
+				return _block.largest_free();
+			}
+
+			/* memory type */
+			auto type(void) const noexcept -> vk::u32 {
+				return _type;
+			}
+
+			/* empty */
+			auto empty(void) const noexcept -> bool {
+				return _block.empty();
+			}
+
+			/* dedicated */
+			auto dedicated(void) const noexcept -> bool {
+				return _dedicated;
+			}
+
+			/* coherent */
+			auto coherent(void) const noexcept -> bool {
+				return _coherent;
+			}
+
+			/* idle since */
+			auto idle_since(void) const noexcept -> vk::u64 {
+				return _idle;
+			}
+
+			/* idle since */
+			auto idle_since(const vk::u64& ___time) noexcept -> void {
+				_idle = ___time;
+			}
+
+	}; // class memory_block
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_MEMORY_BLOCK___
@@ -0,0 +1,475 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_MEMORY_POOL___
+#define ___RENDERX_VULKAN_MEMORY_POOL___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vk/functions.hpp"
+#include "engine/vulkan/device.hpp"
+#include "renderx/vulkan/memory_block.hpp"
+#include "renderx/time/now.hpp"
+
+#include <vector>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- M E M O R Y  P O O L ------------------------------------------------
+
+	class memory_pool final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* size type */
+			using size_type = vk::device_size;
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::memory_pool;
+
+
+			// -- private constants -------------------------------------------
+
+			enum : size_type {
+				/* large heap threshold */
+				___LARGE_HEAP___ = 1024U * 1024U * 1024U,
+				/* block size on large heaps */
+				___LARGE_BLOCK___ = 256U * 1024U * 1024U,
+				/* minimum block size */
+				___MIN_BLOCK___ = 1024U * 1024U
+			};
+
+
+			// -- private members ---------------------------------------------
+
+			/* memory type */
+			vk::u32 _type;
+
+			/* memory properties */
+			vk::memory_property_flags _flags;
+
+			/* heap index */
+			vk::u32 _heap;
+
+			/* maximum block size */
+			size_type _max_block;
+
+			/* next block size */
+			size_type _next_block;
+
+			/* placement granularity (non coherent atom, else 1) */
+			size_type _atom;
+
+			/* idle period (nanoseconds) */
+			rx::umax _idle_period;
+
+			/* blocks */
+			std::vector<vulkan::memory_block*> _blocks;
+
+			/* dedicated blocks (one resource each) */
+			std::vector<vulkan::memory_block*> _dedicated;
+
+			/* reserved bytes */
+			size_type _reserved;
+
+			/* used bytes */
+			size_type _used;
+
+			/* peak used bytes */
+			size_type _peak;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			memory_pool(void) = delete;
+
+			/* memory type / idle period constructor */
+			memory_pool(const vk::u32& ___type, const rx::umax& ___idle)
+			: _type{___type}, _flags{0U}, _heap{0U}, _max_block{0U},
+			  _next_block{0U}, _atom{1U}, _idle_period{___idle}, _blocks{}, _dedicated{},
+			  _reserved{0U}, _used{0U}, _peak{0U} {
+
+				vk::physical_device_memory_properties properties;
+
+				// get physical device memory properties
+				::vk_get_physical_device_memory_properties(vulkan::device::physical(), &properties);
+
+				_flags = properties.memoryTypes[___type].propertyFlags;
+				_heap  = properties.memoryTypes[___type].heapIndex;
+
+				const size_type heap = properties.memoryHeaps[_heap].size;
+
+				// non coherent ranges are flushed by whole atoms,
+				// so no two allocations may share one
+				if ((_flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)  != 0U
+				 && (_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0U)
+					_atom = vk::get_physical_device_properties(vulkan::device::physical())
+								.limits.nonCoherentAtomSize;
+
+				// small heaps get an eighth of their size
+				_max_block = heap <= ___LARGE_HEAP___ ? heap / 8U : ___LARGE_BLOCK___;
+
+				// start small, grow up to max block size
+				_next_block = _max_block / 8U;
+
+				if (_next_block < ___MIN_BLOCK___)
+					_next_block = ___MIN_BLOCK___ < _max_block ? ___MIN_BLOCK___ : _max_block;
+			}
+
+			/* deleted copy constructor */
+			memory_pool(const ___self&) = delete;
+
+			/* deleted move constructor */
+			memory_pool(___self&&) = delete;
+
+			/* destructor */
+			~memory_pool(void) noexcept {
+
+				for (auto* block : _blocks)
+					delete block;
+
+				for (auto* block : _dedicated)
+					delete block;
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* allocate */
+			auto allocate(const vk::memory_requirements& ___req, vulkan::memory_block::range& ___rg) -> vulkan::memory_block& {
+
+				const vk::memory_requirements req = ___self::_atom_align(___req);
+
+				// try newest blocks first, they have most free space
+				for (auto it = _blocks.rbegin(); it != _blocks.rend(); ++it) {
+
+					const size_type before = (*it)->used();
+
+					if ((*it)->allocate(req.size, req.alignment, ___rg) == true)
+						return ___self::_account(**it, before);
+				}
+
+				// chain a new block
+				auto& block = ___self::_new_block(req.size + req.alignment);
+
+				if (block.allocate(req.size, req.alignment, ___rg) == false)
+					throw std::runtime_error("out of memory bounds");
+
+				return ___self::_account(block, 0U);
+			}
+
+			/* allocate dedicated (own device memory, bound to ___buffer) */
+			auto allocate_dedicated(const vk::memory_requirements& ___req,
+									const vk::buffer& ___buffer,
+									vulkan::memory_block::range& ___rg) -> vulkan::memory_block& {
+
+				const vk::memory_requirements req = ___self::_atom_align(___req);
+
+				_dedicated.reserve(_dedicated.size() + 1U);
+				_dedicated.push_back(new vulkan::memory_block{_type, req.size, _flags, ___buffer});
+
+				_reserved += req.size;
+
+				auto& block = *_dedicated.back();
+
+				// whole memory is the single range
+				if (block.allocate(req.size, 1U, ___rg) == false)
+					throw std::runtime_error("out of memory bounds");
+
+				return ___self::_account(block, 0U);
+			}
+
+			/* allocate elsewhere (existing blocks only, never grows) */
+			auto allocate_elsewhere(const vk::memory_requirements& ___req,
+									vulkan::memory_block::range& ___rg,
+									const vulkan::memory_block* ___exclude) -> vulkan::memory_block* {
+
+				const vk::memory_requirements req = ___self::_atom_align(___req);
+
+				for (auto it = _blocks.rbegin(); it != _blocks.rend(); ++it) {
+
+					if (*it == ___exclude)
+						continue;
+
+					const size_type before = (*it)->used();
+
+					if ((*it)->allocate(req.size, req.alignment, ___rg) == true)
+						return &___self::_account(**it, before);
+				}
+
+				return nullptr;
+			}
+
+			/* free */
+			auto free(vulkan::memory_block& ___block, const vulkan::memory_block::node_type ___node) -> void {
+
+				const size_type before = ___block.used();
+
+				___block.free(___node);
+
+				_used -= before - ___block.used();
+
+				// dedicated memory goes back to the driver right away
+				if (___block.dedicated() == true) {
+					___self::_release_dedicated(___block);
+					return;
+				}
+
+				// start idle countdown
+				if (___block.empty() == true)
+					___block.idle_since(rx::now());
+			}
+
+			/* collect */
+			auto collect(const rx::umax& ___now) noexcept -> void {
+
+				// release blocks empty for longer than idle period
+				for (auto it = _blocks.begin(); it != _blocks.end();) {
+
+					vulkan::memory_block* block = *it;
+
+					if (block->empty() == false
+					|| (___now - block->idle_since()) < _idle_period) {
+						++it;
+						continue;
+					}
+
+					_reserved -= block->size();
+
+					delete block;
+					it = _blocks.erase(it);
+				}
+			}
+
+
+			/* trim (release every empty block now) */
+			auto trim(void) noexcept -> void {
+
+				for (auto it = _blocks.begin(); it != _blocks.end();) {
+
+					vulkan::memory_block* block = *it;
+
+					if (block->empty() == false) {
+						++it;
+						continue;
+					}
+
+					_reserved -= block->size();
+
+					delete block;
+					it = _blocks.erase(it);
+				}
+			}
+
+			/* sparsest block (below occupancy ratio, nullptr if none) */
+			auto sparsest(const float ___ratio) const noexcept -> vulkan::memory_block* {
+
+				// a single block has nowhere to move to
+				if (_blocks.size() < 2U)
+					return nullptr;
+
+				vulkan::memory_block* sparse = nullptr;
+				float lowest = ___ratio;
+
+				for (auto* block : _blocks) {
+
+					if (block->empty() == true)
+						continue;
+
+					const float ratio = static_cast<float>(block->used())
+									  / static_cast<float>(block->size());
+
+					if (ratio < lowest) {
+						lowest = ratio;
+						sparse = block;
+					}
+				}
+
+				return sparse;
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* memory type */
+			auto type(void) const noexcept -> vk::u32 {
+				return _type;
+			}
+
+			/* memory properties */
+			auto flags(void) const noexcept -> vk::memory_property_flags {
+				return _flags;
+			}
+
+			/* heap index */
+			auto heap(void) const noexcept -> vk::u32 {
+				return _heap;
+			}
+
+			/* blocks */
+			auto blocks(void) const noexcept -> const std::vector<vulkan::memory_block*>& {
+				return _blocks;
+			}
+
+			/* dedicated blocks */
+			auto dedicated(void) const noexcept -> const std::vector<vulkan::memory_block*>& {
+				return _dedicated;
+			}
+
+			/* dedicated threshold (larger requests get their own memory) */
+			auto dedicated_threshold(void) const noexcept -> size_type {
+				// keep blocks dense: more than half a block never shares one
+				return _max_block / 2U;
+			}
+
+			/* reserved bytes */
+			auto reserved(void) const noexcept -> size_type {
+				return _reserved;
+			}
+
+			/* used bytes */
+			auto used(void) const noexcept -> size_type {
+				return _used;
+			}
+
+			/* peak used bytes */
+			auto peak(void) const noexcept -> size_type {
+				return _peak;
+			}
+
+			/* allocation count */
+			auto count(void) const noexcept -> vk::u32 {
+
+				vk::u32 count = 0U;
+
+				for (const auto* block : _blocks)
+					count += block->count();
+
+				// one allocation per dedicated block
+				return count + static_cast<vk::u32>(_dedicated.size());
+			}
+
+			/* largest free range */
+			auto largest_free(void) const noexcept -> size_type {
+
+				size_type largest = 0U;
+
+				for (const auto* block : _blocks) {
+					const size_type free = block->largest_free();
+					if (free > largest)
+						largest = free;
+				}
+
+				return largest;
+			}
+
+			/* idle period */
+			auto idle_period(const rx::umax& ___idle) noexcept -> void {
+				_idle_period = ___idle;
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* new block */
+			auto _new_block(const size_type& ___min) -> vulkan::memory_block& {
+
+				size_type size = _next_block;
+
+				// oversized request gets a block of its own size
+				if (size < ___min)
+					size = (___min + ___MIN_BLOCK___ - 1U) & ~static_cast<size_type>(___MIN_BLOCK___ - 1U);
+
+				// grow next block size
+				if (_next_block < _max_block) {
+					_next_block <<= 1U;
+					if (_next_block > _max_block)
+						_next_block = _max_block;
+				}
+
+				_blocks.reserve(_blocks.size() + 1U);
+				_blocks.push_back(new vulkan::memory_block{_type, size, _flags});
+
+				_reserved += size;
+
+				return *_blocks.back();
+			}
+
+			/* release dedicated */
+			auto _release_dedicated(vulkan::memory_block& ___block) noexcept -> void {
+
+				for (auto it = _dedicated.begin(); it != _dedicated.end(); ++it) {
+
+					if (*it != &___block)
+						continue;
+
+					_reserved -= ___block.size();
+
+					delete *it;
+					_dedicated.erase(it);
+					return;
+				}
+			}
+
+			/* atom align (size and alignment rounded to whole atoms) */
+			auto _atom_align(const vk::memory_requirements& ___req) const noexcept -> vk::memory_requirements {
+
+				if (_atom == 1U)
+					return ___req;
+
+				return vk::memory_requirements{
+					.size           = (___req.size + _atom - 1U) & ~(_atom - 1U),
+					.alignment      = ___req.alignment > _atom ? ___req.alignment : _atom,
+					.memoryTypeBits = ___req.memoryTypeBits
+				};
+			}
+
+			/* account */
+			auto _account(vulkan::memory_block& ___block, const size_type& ___before) noexcept -> vulkan::memory_block& {
+
+				// block usage includes tlsf rounding
+				_used += ___block.used() - ___before;
+
+				if (_used > _peak)
+					_peak = _used;
+
+				return ___block;
+			}
+
+	}; // class memory_pool
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_MEMORY_POOL___
@@ -0,0 +1,312 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_MEMORY_STATS___
+#define ___RENDERX_VULKAN_MEMORY_STATS___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vulkan/device.hpp"
+#include "renderx/vulkan/memory_pool.hpp"
+
+#include <ostream>
+#include <sstream>
+#include <string>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- M E M O R Y  S T A T S ----------------------------------------------
+
+	class memory_stats final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* size type */
+			using size_type = vk::device_size;
+
+
+			/* common counters */
+			struct counters {
+
+				/* reserved bytes (device memory blocks) */
+				size_type reserved;
+
+				/* used bytes (live allocations) */
+				size_type used;
+
+				/* largest free range */
+				size_type largest_free;
+
+				/* peak used bytes (summed over pools) */
+				size_type peak;
+
+				/* allocation count */
+				vk::u32 count;
+
+				/* block count */
+				vk::u32 blocks;
+
+				/* dedicated allocation count */
+				vk::u32 dedicated;
+
+				/* fragmentation (0 = one free range, 1 = scattered) */
+				auto fragmentation(void) const noexcept -> float {
+
+					const size_type free = reserved - used;
+
+					if (free == 0U)
+						return 0.0f;
+
+					return 1.0f - (static_cast<float>(largest_free)
+								 / static_cast<float>(free));
+				}
+
+			}; // struct counters
+
+
+			/* memory type stats */
+			struct type_stats final : counters {
+
+				/* heap index */
+				vk::u32 heap;
+
+				/* property flags */
+				vk::memory_property_flags flags;
+
+			}; // struct type_stats
+
+
+			/* memory heap stats */
+			struct heap_stats final : counters {
+
+				/* heap size */
+				size_type size;
+
+				/* heap flags */
+				vk::memory_heap_flags flags;
+
+				/* driver budget (VK_EXT_memory_budget, else heap size) */
+				size_type budget;
+
+				/* driver usage, whole process (VK_EXT_memory_budget, else 0) */
+				size_type usage;
+
+			}; // struct heap_stats
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::memory_stats;
+
+
+			// -- private members ---------------------------------------------
+
+			/* heaps */
+			heap_stats _heaps[VK_MAX_MEMORY_HEAPS];
+
+			/* types */
+			type_stats _types[VK_MAX_MEMORY_TYPES];
+
+			/* heap count */
+			vk::u32 _heap_count;
+
+			/* type count */
+			vk::u32 _type_count;
+
+			/* budget available */
+			bool _budget;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor */
+			memory_stats(void)
+			: _heaps{}, _types{}, _heap_count{0U}, _type_count{0U},
+			  _budget{vulkan::device::memory_budget()} {
+
+				vk::physical_device_memory_budget_properties budget {
+					.sType      = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT,
+					.pNext      = nullptr,
+					.heapBudget = {},
+					.heapUsage  = {}
+				};
+
+				vk::physical_device_memory_properties2 properties {
+					.sType            = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2,
+					// chain budget query only when extension is enabled
+					.pNext            = _budget ? &budget : nullptr,
+					.memoryProperties = {}
+				};
+
+				// get physical device memory properties (and budget)
+				::vk_get_physical_device_memory_properties2(vulkan::device::physical(), &properties);
+
+				const auto& memory = properties.memoryProperties;
+
+				_heap_count = memory.memoryHeapCount;
+				_type_count = memory.memoryTypeCount;
+
+				for (vk::u32 i = 0U; i < _heap_count; ++i) {
+					_heaps[i].size   = memory.memoryHeaps[i].size;
+					_heaps[i].flags  = memory.memoryHeaps[i].flags;
+					_heaps[i].budget = _budget ? budget.heapBudget[i] : memory.memoryHeaps[i].size;
+					_heaps[i].usage  = _budget ? budget.heapUsage[i]  : 0U;
+				}
+
+				for (vk::u32 i = 0U; i < _type_count; ++i) {
+					_types[i].heap  = memory.memoryTypes[i].heapIndex;
+					_types[i].flags = memory.memoryTypes[i].propertyFlags;
+				}
+			}
+
+
+			// -- public methods ----------------------------------------------
+
+			/* accumulate */
+			auto accumulate(const vulkan::memory_pool& ___pool) noexcept -> void {
+
+				const size_type largest = ___pool.largest_free();
+				const auto blocks       = static_cast<vk::u32>(___pool.blocks().size());
+				const auto dedicated    = static_cast<vk::u32>(___pool.dedicated().size());
+
+				___self::_add(_types[___pool.type()], ___pool, largest, blocks, dedicated);
+				___self::_add(_heaps[___pool.heap()], ___pool, largest, blocks, dedicated);
+			}
+
+			/* json */
+			auto json(std::ostream& ___os) const -> void {
+
+				___os << "{\"budget\":" << (_budget ? "true" : "false");
+
+				___os << ",\"heaps\":[";
+
+				for (vk::u32 i = 0U; i < _heap_count; ++i) {
+
+					const heap_stats& h = _heaps[i];
+
+					___os << (i ? "," : "") << "{\"index\":" << i
+						  << ",\"size\":" << h.size
+						  << ",\"device_local\":"
+						  << ((h.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) ? "true" : "false")
+						  << ",\"budget\":" << h.budget
+						  << ",\"usage\":" << h.usage;
+
+					___self::_json(___os, h);
+
+					___os << '}';
+				}
+
+				___os << "],\"types\":[";
+
+				for (vk::u32 i = 0U; i < _type_count; ++i) {
+
+					const type_stats& t = _types[i];
+
+					___os << (i ? "," : "") << "{\"index\":" << i
+						  << ",\"heap\":" << t.heap
+						  << ",\"flags\":" << t.flags;
+
+					___self::_json(___os, t);
+
+					___os << '}';
+				}
+
+				___os << "]}";
+			}
+
+			/* json */
+			auto json(void) const -> std::string {
+
+				std::ostringstream os;
+				___self::json(os);
+
+				return os.str();
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* heap */
+			auto heap(const vk::u32& ___idx) const noexcept -> const heap_stats& {
+				return _heaps[___idx];
+			}
+
+			/* type */
+			auto type(const vk::u32& ___idx) const noexcept -> const type_stats& {
+				return _types[___idx];
+			}
+
+			/* heap count */
+			auto heap_count(void) const noexcept -> vk::u32 {
+				return _heap_count;
+			}
+
+			/* type count */
+			auto type_count(void) const noexcept -> vk::u32 {
+				return _type_count;
+			}
+
+			/* budget available */
+			auto has_budget(void) const noexcept -> bool {
+				return _budget;
+			}
+
+
+		private:
+
+			// -- private static methods --------------------------------------
+
+			/* add */
+			static auto _add(counters& ___cs,
+							 const vulkan::memory_pool& ___pool,
+							 const size_type& ___largest,
+							 const vk::u32& ___blocks,
+							 const vk::u32& ___dedicated) noexcept -> void {
+
+				___cs.reserved  += ___pool.reserved();
+				___cs.used      += ___pool.used();
+				___cs.peak      += ___pool.peak();
+				___cs.count     += ___pool.count();
+				___cs.blocks    += ___blocks;
+				___cs.dedicated += ___dedicated;
+
+				if (___largest > ___cs.largest_free)
+					___cs.largest_free = ___largest;
+			}
+
+			/* json */
+			static auto _json(std::ostream& ___os, const counters& ___cs) -> void {
+
+				___os << ",\"reserved\":" << ___cs.reserved
+					  << ",\"used\":" << ___cs.used
+					  << ",\"peak\":" << ___cs.peak
+					  << ",\"count\":" << ___cs.count
+					  << ",\"blocks\":" << ___cs.blocks
+					  << ",\"dedicated\":" << ___cs.dedicated
+					  << ",\"largest_free\":" << ___cs.largest_free
+					  << ",\"fragmentation\":" << ___cs.fragmentation();
+			}
+
+	}; // class memory_stats
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_MEMORY_STATS___
@@ -0,0 +1,364 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_PARALLEL_RECORDER___
+#define ___RENDERX_VULKAN_PARALLEL_RECORDER___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vulkan/commands.hpp"
+#include "engine/vulkan/command_pool.hpp"
+#include "engine/vulkan/command_buffer.hpp"
+#include "engine/vulkan/render_pass.hpp"
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- P A R A L L E L  R E C O R D E R ------------------------------------
+
+	class parallel_recorder final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* size type */
+			using size_type = vk::u32;
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::parallel_recorder;
+
+			/* job thunk (context, secondary, first, last) */
+			using ___thunk = void (*)(void*, const vulkan::command_buffer<vulkan::secondary>&,
+									  size_type, size_type);
+
+
+			/* worker */
+			struct ___worker final {
+
+				/* command pools (one per slot, never shared) */
+				std::vector<vulkan::command_pool> pools;
+
+				/* secondary command buffers (one per slot) */
+				std::vector<vulkan::commands<vulkan::secondary>> cmds;
+
+				/* thread */
+				std::thread thread;
+
+			}; // struct ___worker
+
+
+			// -- private constants -------------------------------------------
+
+			enum : size_type {
+				/* maximum workers */
+				___MAX_WORKERS___ = 16U
+			};
+
+
+			// -- private members ---------------------------------------------
+
+			/* workers */
+			std::vector<___worker> _workers;
+
+			/* recorded handles of last pass */
+			std::vector<vk::command_buffer> _recorded;
+
+			/* mutex */
+			std::mutex _mutex;
+
+			/* wake condition */
+			std::condition_variable _wake;
+
+			/* done condition */
+			std::condition_variable _done;
+
+			/* job thunk */
+			___thunk _thunk;
+
+			/* job context */
+			void* _context;
+
+			/* render pass */
+			const vulkan::render_pass* _render_pass;
+
+			/* framebuffer */
+			vk::framebuffer _framebuffer;
+
+			/* slot index */
+			size_type _slot;
+
+			/* item count */
+			size_type _count;
+
+			/* chunk count */
+			size_type _chunks;
+
+			/* job generation */
+			vk::u64 _generation;
+
+			/* workers still recording */
+			size_type _remaining;
+
+			/* first worker failure */
+			std::exception_ptr _error;
+
+			/* stop flag */
+			bool _stop;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			parallel_recorder(void) = delete;
+
+			/* slot count constructor (one worker per spare hardware thread) */
+			parallel_recorder(const size_type& ___slots)
+			: ___self{___slots, ___self::_default_workers()} {
+			}
+
+			/* slot / worker count constructor
+			 * a slot is recorded again only once its previous submission completed
+			 * (one slot per swapchain image keeps secondaries valid for retained primaries) */
+			parallel_recorder(const size_type& ___slots, const size_type& ___workers)
+			: _workers{}, _recorded{}, _mutex{}, _wake{}, _done{},
+			  _thunk{nullptr}, _context{nullptr}, _render_pass{nullptr},
+			  _framebuffer{VK_NULL_HANDLE}, _slot{0U}, _count{0U}, _chunks{0U},
+			  _generation{0U}, _remaining{0U}, _error{}, _stop{false} {
+
+				const size_type count = ___workers == 0U ? 1U
+									  : (___workers > ___MAX_WORKERS___ ? ___MAX_WORKERS___ : ___workers);
+
+				// no reallocation once threads hold their index
+				_workers.resize(count);
+				_recorded.reserve(count);
+
+				for (auto& worker : _workers) {
+
+					worker.pools.reserve(___slots);
+					worker.cmds.reserve(___slots);
+
+					// transient pools, reset as a whole on each record
+					for (size_type f = 0U; f < ___slots; ++f) {
+						worker.pools.emplace_back(VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+						worker.cmds.emplace_back(worker.pools.back().underlying(), 1U);
+					}
+				}
+
+				for (size_type i = 0U; i < count; ++i)
+					_workers[i].thread = std::thread{&___self::_run, this, i};
+			}
+
+			/* deleted copy constructor */
+			parallel_recorder(const ___self&) = delete;
+
+			/* deleted move constructor */
+			parallel_recorder(___self&&) = delete;
+
+			/* destructor */
+			~parallel_recorder(void) noexcept {
+
+				{
+					const std::lock_guard<std::mutex> lock{_mutex};
+					_stop = true;
+				}
+
+				_wake.notify_all();
+
+				for (auto& worker : _workers)
+					worker.thread.join();
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* record (split [0, count) across workers, call once the slot is no longer pending)
+			 * each chunk calls ___fn(secondary, first, last) inside a begun secondary buffer,
+			 * the secondary inherits no state: bind pipeline, viewport and buffers again */
+			template <typename ___function>
+			auto record(const size_type& ___slot,
+						const vulkan::render_pass& ___render_pass,
+						const vk::framebuffer& ___framebuffer,
+						const size_type& ___count,
+						___function& ___fn) -> void {
+
+				_recorded.clear();
+
+				if (___count == 0U)
+					return;
+
+				const auto workers = static_cast<size_type>(_workers.size());
+
+				{
+					const std::lock_guard<std::mutex> lock{_mutex};
+
+					_thunk       = &___self::_invoke<___function>;
+					_context     = &___fn;
+					_render_pass = &___render_pass;
+					_framebuffer = ___framebuffer;
+					_slot        = ___slot;
+					_count       = ___count;
+					_chunks      = ___count < workers ? ___count : workers;
+					_remaining   = workers;
+					_error       = nullptr;
+
+					++_generation;
+				}
+
+				_wake.notify_all();
+
+				std::unique_lock<std::mutex> lock{_mutex};
+
+				_done.wait(lock, [this]() noexcept -> bool { return _remaining == 0U; });
+
+				if (_error != nullptr)
+					std::rethrow_exception(_error);
+
+				// stitch in worker order, draws keep their submission order
+				for (size_type i = 0U; i < _chunks; ++i)
+					_recorded.push_back(_workers[i].cmds[___slot].data()[0U]);
+			}
+
+			/* execute (into a render pass begun with secondary contents) */
+			auto execute(const vulkan::command_buffer<vulkan::primary>& ___primary) const noexcept -> void {
+				___primary.execute_secondary_commands(_recorded.data(),
+						static_cast<vk::u32>(_recorded.size()));
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* workers */
+			auto workers(void) const noexcept -> size_type {
+				return static_cast<size_type>(_workers.size());
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* run (worker loop) */
+			auto _run(const size_type ___index) -> void {
+
+				vk::u64 seen = 0U;
+
+				while (true) {
+
+					std::unique_lock<std::mutex> lock{_mutex};
+
+					_wake.wait(lock, [this, &seen]() noexcept -> bool {
+						return _stop == true || _generation != seen;
+					});
+
+					if (_stop == true)
+						return;
+
+					seen = _generation;
+
+					const size_type chunks = _chunks;
+					const size_type count  = _count;
+					const size_type slot   = _slot;
+
+					lock.unlock();
+
+					std::exception_ptr error = nullptr;
+
+					// idle worker when there are fewer items than workers
+					if (___index < chunks) {
+
+						try {
+							___self::_record(___index, slot,
+									(count * ___index) / chunks,
+									(count * (___index + 1U)) / chunks);
+						}
+						catch (...) {
+							error = std::current_exception();
+						}
+					}
+
+					lock.lock();
+
+					if (error != nullptr && _error == nullptr)
+						_error = error;
+
+					if (--_remaining == 0U)
+						_done.notify_one();
+				}
+			}
+
+			/* record (one chunk) */
+			auto _record(const size_type ___index, const size_type ___slot,
+						 const size_type ___first, const size_type ___last) -> void {
+
+				___worker& worker = _workers[___index];
+
+				// slot no longer pending, every buffer of this pool is done
+				worker.pools[___slot].reset_to_pool();
+
+				auto& cmd = worker.cmds[___slot][0U];
+
+				cmd.begin(*_render_pass, _framebuffer);
+
+				_thunk(_context, cmd, ___first, ___last);
+
+				cmd.end();
+			}
+
+
+			// -- private static methods --------------------------------------
+
+			/* invoke */
+			template <typename ___function>
+			static auto _invoke(void* ___context,
+								const vulkan::command_buffer<vulkan::secondary>& ___cmd,
+								const size_type ___first, const size_type ___last) -> void {
+				(*static_cast<___function*>(___context))(___cmd, ___first, ___last);
+			}
+
+			/* default workers */
+			static auto _default_workers(void) noexcept -> size_type {
+
+				const size_type hardware = static_cast<size_type>(std::thread::hardware_concurrency());
+
+				// keep one thread for the main loop
+				return hardware > 1U ? hardware - 1U : 1U;
+			}
+
+	}; // class parallel_recorder
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_PARALLEL_RECORDER___
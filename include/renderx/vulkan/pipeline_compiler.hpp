@@ -0,0 +1,231 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_PIPELINE_COMPILER___
+#define ___RENDERX_VULKAN_PIPELINE_COMPILER___
+
+#include "engine/vk/typedefs.hpp"
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- P I P E L I N E  C O M P I L E R ------------------------------------
+
+	class pipeline_compiler final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* size type */
+			using size_type = vk::u32;
+
+			/* job thunk (context) */
+			using thunk_type = void (*)(void*);
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::pipeline_compiler;
+
+
+			/* job */
+			struct ___job final {
+
+				/* thunk */
+				thunk_type thunk;
+
+				/* context (must outlive the job) */
+				void* context;
+
+			}; // struct ___job
+
+
+			// -- private constants -------------------------------------------
+
+			enum : size_type {
+				/* maximum workers (driver compilers are heavy) */
+				___MAX_WORKERS___ = 4U
+			};
+
+
+			// -- private members ---------------------------------------------
+
+			/* threads */
+			std::vector<std::thread> _threads;
+
+			/* queued jobs (first in, first out) */
+			std::deque<___job> _jobs;
+
+			/* mutex */
+			std::mutex _mutex;
+
+			/* wake condition */
+			std::condition_variable _wake;
+
+			/* idle condition */
+			std::condition_variable _idle;
+
+			/* jobs being compiled */
+			size_type _running;
+
+			/* stop flag */
+			bool _stop;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor (one worker per four hardware threads) */
+			pipeline_compiler(void)
+			: ___self{___self::_default_workers()} {
+			}
+
+			/* worker count constructor */
+			pipeline_compiler(const size_type& ___workers)
+			: _threads{}, _jobs{}, _mutex{}, _wake{}, _idle{}, _running{0U}, _stop{false} {
+
+				const size_type count = ___workers == 0U ? 1U
+									  : (___workers > ___MAX_WORKERS___ ? ___MAX_WORKERS___ : ___workers);
+
+				_threads.reserve(count);
+
+				for (size_type i = 0U; i < count; ++i)
+					_threads.emplace_back(&___self::_run, this);
+			}
+
+			/* deleted copy constructor */
+			pipeline_compiler(const ___self&) = delete;
+
+			/* deleted move constructor */
+			pipeline_compiler(___self&&) = delete;
+
+			/* destructor (queued jobs are dropped, running ones finish) */
+			~pipeline_compiler(void) noexcept {
+
+				{
+					const std::lock_guard<std::mutex> lock{_mutex};
+					_stop = true;
+					_jobs.clear();
+				}
+
+				_wake.notify_all();
+
+				for (auto& thread : _threads)
+					thread.join();
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* submit (thunk runs on a worker, must not throw) */
+			auto submit(const thunk_type ___thunk, void* ___context) -> void {
+
+				{
+					const std::lock_guard<std::mutex> lock{_mutex};
+					_jobs.push_back(___job{___thunk, ___context});
+				}
+
+				_wake.notify_one();
+			}
+
+			/* drain (block until every submitted job is done) */
+			auto drain(void) -> void {
+
+				std::unique_lock<std::mutex> lock{_mutex};
+
+				_idle.wait(lock, [this]() noexcept -> bool {
+					return _jobs.empty() == true && _running == 0U;
+				});
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* workers */
+			auto workers(void) const noexcept -> size_type {
+				return static_cast<size_type>(_threads.size());
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* run (worker loop) */
+			auto _run(void) -> void {
+
+				std::unique_lock<std::mutex> lock{_mutex};
+
+				while (true) {
+
+					_wake.wait(lock, [this]() noexcept -> bool {
+						return _stop == true || _jobs.empty() == false;
+					});
+
+					if (_stop == true)
+						return;
+
+					const ___job job = _jobs.front();
+					_jobs.pop_front();
+					++_running;
+
+					lock.unlock();
+
+					// compile outside the lock, other workers keep going
+					job.thunk(job.context);
+
+					lock.lock();
+
+					if (--_running == 0U && _jobs.empty() == true)
+						_idle.notify_all();
+				}
+			}
+
+
+			// -- private static methods --------------------------------------
+
+			/* default workers */
+			static auto _default_workers(void) noexcept -> size_type {
+
+				const size_type hardware = static_cast<size_type>(std::thread::hardware_concurrency());
+
+				// frame loop and recorders keep the rest
+				return hardware >= 8U ? hardware / 4U : 1U;
+			}
+
+	}; // class pipeline_compiler
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_PIPELINE_COMPILER___
@@ -0,0 +1,290 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_STATE_TRACKER___
+#define ___RENDERX_VULKAN_STATE_TRACKER___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vulkan/command_buffer.hpp"
+#include "engine/vulkan/pipeline.hpp"
+#include "engine/vulkan/swapchain.hpp"
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- S T A T E  T R A C K E R --------------------------------------------
+
+	template <typename ___type>
+	class state_tracker final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* command buffer type */
+			using command_buffer_type = vulkan::command_buffer<___type>;
+
+			/* size type */
+			using size_type = vk::u32;
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::state_tracker<___type>;
+
+
+			// -- private constants -------------------------------------------
+
+			enum : vk::u32 {
+				/* tracked vertex bindings (vertex and instance streams) */
+				___BINDINGS___ = 2U
+			};
+
+
+			// -- private members ---------------------------------------------
+
+			/* command buffer */
+			const command_buffer_type& _cmd;
+
+			/* bound pipeline */
+			vk::pipeline _pipeline;
+
+			/* layout of bound pipeline */
+			vk::pipeline_layout _layout;
+
+			/* bound descriptor set (set 0) */
+			vk::descriptor_set _set;
+
+			/* bound vertex buffers (per binding) */
+			vk::buffer _vertices[___BINDINGS___];
+
+			/* bound vertex offsets (per binding) */
+			vk::device_size _offsets[___BINDINGS___];
+
+			/* bound index buffer */
+			vk::buffer _indices;
+
+			/* bound index type */
+			vk::index_type _index_type;
+
+			/* viewport extent */
+			vk::extent2D _viewport;
+
+			/* scissor extent */
+			vk::extent2D _scissor;
+
+			/* issued commands */
+			size_type _issued;
+
+			/* dropped commands */
+			size_type _dropped;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			state_tracker(void) = delete;
+
+			/* command buffer constructor (buffer must be begun, nothing bound yet) */
+			explicit state_tracker(const vulkan::command_buffer<___type>& ___cmd) noexcept
+			: _cmd{___cmd},
+			  _pipeline{VK_NULL_HANDLE}, _layout{VK_NULL_HANDLE}, _set{VK_NULL_HANDLE},
+			  _vertices{VK_NULL_HANDLE, VK_NULL_HANDLE}, _offsets{0U, 0U}, _indices{VK_NULL_HANDLE},
+			  _index_type{VK_INDEX_TYPE_UINT16},
+			  _viewport{0U, 0U}, _scissor{0U, 0U},
+			  _issued{0U}, _dropped{0U} {
+			}
+
+			/* deleted copy constructor */
+			state_tracker(const ___self&) = delete;
+
+			/* deleted move constructor */
+			state_tracker(___self&&) = delete;
+
+			/* destructor */
+			~state_tracker(void) noexcept = default;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* set viewport */
+			auto set_viewport(const vulkan::swapchain& ___swapchain) noexcept -> void {
+
+				if (___self::_same(_viewport, ___swapchain.extent()) == true) {
+					++_dropped;
+					return;
+				}
+
+				_viewport = ___swapchain.extent();
+				_cmd.set_viewport(___swapchain);
+				++_issued;
+			}
+
+			/* set scissor */
+			auto set_scissor(const vulkan::swapchain& ___swapchain) noexcept -> void {
+
+				if (___self::_same(_scissor, ___swapchain.extent()) == true) {
+					++_dropped;
+					return;
+				}
+
+				_scissor = ___swapchain.extent();
+				_cmd.set_scissor(___swapchain);
+				++_issued;
+			}
+
+			/* bind pipeline */
+			auto bind_pipeline(const vulkan::pipeline& ___pipeline) noexcept -> void {
+
+				const vk::pipeline& handle = ___pipeline;
+
+				if (handle == _pipeline) {
+					++_dropped;
+					return;
+				}
+
+				// incompatible layout disturbs bound sets
+				if (___pipeline.layout() != _layout)
+					_set = VK_NULL_HANDLE;
+
+				_pipeline = handle;
+				_layout   = ___pipeline.layout();
+				_cmd.bind_pipeline(handle);
+				++_issued;
+			}
+
+			/* bind descriptor set (set 0) */
+			auto bind_descriptor_set(const vulkan::pipeline& ___pipeline,
+									 const vk::descriptor_set& ___set) noexcept -> void {
+
+				if (___set == _set && ___pipeline.layout() == _layout) {
+					++_dropped;
+					return;
+				}
+
+				_set = ___set;
+				_cmd.bind_descriptor_set(___pipeline, ___set);
+				++_issued;
+			}
+
+			/* bind vertex buffer (binding 0 or 1, offset in bytes) */
+			auto bind_vertex_buffer(const vk::buffer& ___buffer,
+									const vk::u32 ___binding = 0U,
+									const vk::device_size ___offset = 0U) noexcept -> void {
+
+				if (___buffer == _vertices[___binding]
+				 && ___offset == _offsets[___binding]) {
+					++_dropped;
+					return;
+				}
+
+				_vertices[___binding] = ___buffer;
+				_offsets[___binding]  = ___offset;
+				_cmd.bind_vertex_buffer(___buffer, ___binding, ___offset);
+				++_issued;
+			}
+
+			/* bind index buffer */
+			auto bind_index_buffer(const vk::buffer& ___buffer,
+								   const vk::index_type& ___index_type) noexcept -> void {
+
+				if (___buffer == _indices && ___index_type == _index_type) {
+					++_dropped;
+					return;
+				}
+
+				_indices    = ___buffer;
+				_index_type = ___index_type;
+				_cmd.bind_index_buffer(___buffer, ___index_type);
+				++_issued;
+			}
+
+			/* push constants (never cached) */
+			template <typename ___constants>
+			auto push_constants(const vulkan::pipeline& ___pipeline,
+								const ___constants& ___value) const noexcept -> void {
+				_cmd.push_constants(___pipeline, ___value);
+			}
+
+			/* draw indexed */
+			auto draw_indexed(const vk::u32 ___index_count,
+							  const vk::u32 ___first_index    = 0U,
+							  const vk::i32 ___vertex_offset  = 0,
+							  const vk::u32 ___instance_count = 1U,
+							  const vk::u32 ___first_instance = 0U) const noexcept -> void {
+				_cmd.draw_indexed(___index_count, ___first_index, ___vertex_offset,
+								  ___instance_count, ___first_instance);
+			}
+
+			/* forget (state unknown, e.g. after executing secondaries) */
+			auto forget(void) noexcept -> void {
+				_pipeline     = VK_NULL_HANDLE;
+				_layout       = VK_NULL_HANDLE;
+				_set          = VK_NULL_HANDLE;
+				_vertices[0U] = VK_NULL_HANDLE;
+				_vertices[1U] = VK_NULL_HANDLE;
+				_indices      = VK_NULL_HANDLE;
+				_viewport     = vk::extent2D{0U, 0U};
+				_scissor      = vk::extent2D{0U, 0U};
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* issued state commands */
+			auto issued(void) const noexcept -> size_type {
+				return _issued;
+			}
+
+			/* dropped (redundant) state commands */
+			auto dropped(void) const noexcept -> size_type {
+				return _dropped;
+			}
+
+			/* underlying */
+			auto underlying(void) const noexcept -> const command_buffer_type& {
+				return _cmd;
+			}
+
+
+		private:
+
+			// -- private static methods --------------------------------------
+
+			/* same extent (zero extent is never bound) */
+			static auto _same(const vk::extent2D& ___a, const vk::extent2D& ___b) noexcept -> bool {
+				return ___a.width  == ___b.width
+					&& ___a.height == ___b.height
+					&& ___a.width  != 0U;
+			}
+
+	}; // class state_tracker
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_STATE_TRACKER___
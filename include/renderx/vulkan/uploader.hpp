@@ -0,0 +1,492 @@
+/* ------------------------------------------------------------------------- */
+/*        :::::::::  :::::::::: ::::    ::: :::::::::  :::::::::: :::::::::  */
+/*       :+:    :+: :+:        :+:+:   :+: :+:    :+: :+:        :+:    :+:  */
+/*      +:+    +:+ +:+        :+:+:+  +:+ +:+    +:+ +:+        +:+    +:+   */
+/*     +#++:++#:  +#++:++#   +#+ +:+ +#+ +#+    +:+ +#++:++#   +#++:++#:     */
+/*    +#+    +#+ +#+        +#+  +#+#+# +#+    +#+ +#+        +#+    +#+     */
+/*   #+#    #+# #+#        #+#   #+#+# #+#    #+# #+#        #+#    #+#      */
+/*  ###    ### ########## ###    #### #########  ########## ###    ###       */
+/* ------------------------------------------------------------------------- */
+
+#ifndef ___RENDERX_VULKAN_UPLOADER___
+#define ___RENDERX_VULKAN_UPLOADER___
+
+#include "engine/vk/typedefs.hpp"
+#include "engine/vulkan/buffer.hpp"
+#include "engine/vulkan/timeline.hpp"
+#include "engine/vulkan/queue.hpp"
+#include "engine/vulkan/commands.hpp"
+#include "engine/vulkan/command_pool.hpp"
+#include "engine/vulkan/command_buffer.hpp"
+
+#include "renderx/vulkan/allocator.hpp"
+#include "renderx/vulkan/index_buffer.hpp"
+#include "renderx/vulkan/vertex_buffer.hpp"
+
+#include <vector>
+
+
+// -- V U L K A N -------------------------------------------------------------
+
+namespace vulkan {
+
+
+	// -- U P L O A D E R -----------------------------------------------------
+
+	class uploader final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* size type */
+			using size_type = vk::device_size;
+
+			/* token type (batch serial = timeline value, 0 is always complete) */
+			using token     = vk::u64;
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* self type */
+			using ___self = vulkan::uploader;
+
+
+			/* batch */
+			struct ___batch final {
+
+				/* ring bytes reserved (padding included) */
+				size_type bytes;
+
+				/* recorded copies */
+				vk::u32 copies;
+
+				/* copied ranges handed to the graphics family (dedicated transfer only) */
+				std::vector<vk::buffer_memory_barrier> ownership;
+
+			}; // struct ___batch
+
+
+			// -- private constants -------------------------------------------
+
+			enum : size_type {
+				/* staging ring size */
+				___RING_SIZE___  = 8U * 1024U * 1024U,
+				/* staging offset alignment */
+				___RING_ALIGN___ = 16U
+			};
+
+			enum : vk::u32 {
+				/* batches in flight */
+				___BATCHES___ = 4U,
+				/* graphics stages reading uploads (geometry, defragmentation copies) */
+				___ACQUIRE_STAGES___ = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT
+			};
+
+
+			// -- private members ---------------------------------------------
+
+			/* queue (copies) */
+			const vulkan::queue& _queue;
+
+			/* graphics queue (reads uploaded data) */
+			const vulkan::queue& _graphics;
+
+			/* command pool (queue family) */
+			vulkan::command_pool _pool;
+
+			/* command buffers (one per batch) */
+			vulkan::commands<vulkan::primary> _cmds;
+
+			/* acquire command pool (graphics family) */
+			vulkan::command_pool _acquire_pool;
+
+			/* acquire command buffers (one per batch, dedicated transfer only) */
+			vulkan::commands<vulkan::primary> _acquires;
+
+			/* timeline (copies of batch n signal n) */
+			vulkan::timeline _timeline;
+
+			/* acquire timeline (graphics side of batch n signals n) */
+			vulkan::timeline _acquired;
+
+			/* batches */
+			___batch _batches[___BATCHES___];
+
+			/* host allocator (shared) */
+			vulkan::allocator<vulkan::cpu_coherent>& _host;
+
+			/* staging buffer */
+			vulkan::buffer _staging;
+
+			/* staging allocation (persistently mapped) */
+			vulkan::allocation _ring;
+
+			/* ring head */
+			size_type _head;
+
+			/* ring reserved bytes */
+			size_type _size;
+
+			/* last submitted serial */
+			token _submitted;
+
+			/* last completed serial */
+			token _completed;
+
+
+		public:
+
+			// -- public lifecycle --------------------------------------------
+
+			/* deleted default constructor */
+			uploader(void) = delete;
+
+			/* queue / host allocator constructor (copies on the graphics queue) */
+			uploader(const vulkan::queue& ___queue,
+					 vulkan::allocator<vulkan::cpu_coherent>& ___host)
+			: ___self{___queue, ___queue, ___host} {
+			}
+
+			/* transfer / graphics queue constructor
+			 * with distinct families, copied ranges are released by the transfer queue
+			 * and acquired by the graphics queue once the copies signal */
+			uploader(const vulkan::queue& ___transfer, const vulkan::queue& ___graphics,
+					 vulkan::allocator<vulkan::cpu_coherent>& ___host)
+			: _queue{___transfer},
+			  _graphics{___graphics},
+			  _pool{VK_COMMAND_POOL_CREATE_TRANSIENT_BIT
+				  | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, ___transfer.family()},
+			  _cmds{_pool.underlying(), ___BATCHES___},
+			  _acquire_pool{VK_COMMAND_POOL_CREATE_TRANSIENT_BIT
+						  | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, ___graphics.family()},
+			  _acquires{_acquire_pool.underlying(), ___BATCHES___},
+			  _timeline{0U}, _acquired{0U}, _batches{}, _host{___host},
+			  _staging{___RING_SIZE___, VK_BUFFER_USAGE_TRANSFER_SRC_BIT},
+			  _ring{_host.allocate_buffer(_staging.underlying())},
+			  _head{0U}, _size{0U}, _submitted{0U}, _completed{0U} {
+			}
+
+			/* deleted copy constructor */
+			uploader(const ___self&) = delete;
+
+			/* deleted move constructor */
+			uploader(___self&&) = delete;
+
+			/* destructor */
+			~uploader(void) noexcept {
+
+				// wait for batches in flight
+				if (_completed < _submitted)
+					___self::_completion().wait(_submitted);
+
+				// staging range back to shared allocator
+				_host.free(_ring);
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* deleted copy assignment operator */
+			auto operator=(const ___self&) -> ___self& = delete;
+
+			/* deleted move assignment operator */
+			auto operator=(___self&&) -> ___self& = delete;
+
+
+			// -- public methods ----------------------------------------------
+
+			/* upload */
+			template <typename ___type>
+			auto upload(const vk::buffer& ___dst,
+						const ___type* ___src,
+						const rx::size_t ___count,
+						size_type ___offset = 0U) -> token {
+
+				const vk::u8* src = reinterpret_cast<const vk::u8*>(___src);
+				size_type bytes   = static_cast<size_type>(___count * sizeof(___type));
+
+				// split into chunks no larger than the ring
+				while (bytes != 0U) {
+
+					const size_type chunk = bytes < ___RING_SIZE___ ? bytes : ___RING_SIZE___;
+
+					// stage chunk and record copy
+					const size_type staged = ___self::_stage(src, chunk);
+
+					___self::_record().copy_buffer(_staging.underlying(), ___dst,
+						vk::buffer_copy{staged, ___offset, chunk});
+
+					___self::_release(___dst, ___offset, chunk);
+
+					src       += chunk;
+					___offset += chunk;
+					bytes     -= chunk;
+				}
+
+				// data is complete once the recording batch completes
+				return ___self::_recording() == true
+					? _submitted + 1U : _submitted;
+			}
+
+			/* upload vertex buffer */
+			template <typename... ___params>
+			auto upload(const vulkan::vertex_buffer& ___dst,
+						const vk::vector<engine::vertex<___params...>>& ___vertices) -> token {
+				return ___self::upload(___dst.underlying(), ___vertices.data(), ___vertices.size());
+			}
+
+			/* upload index buffer */
+			template <typename ___type>
+			auto upload(const vulkan::index_buffer& ___dst,
+						const vk::vector<___type>& ___indices) -> token {
+				return ___self::upload(___dst.underlying(), ___indices.data(), ___indices.size());
+			}
+
+			/* submit */
+			auto submit(void) -> token {
+
+				// nothing recorded
+				if (___self::_recording() == false)
+					return _submitted;
+
+				const auto index = static_cast<vk::u32>(_submitted % ___BATCHES___);
+
+				auto&     cmd   = _cmds[index];
+				___batch& batch = _batches[index];
+
+				const token serial = _submitted + 1U;
+
+				const auto barriers = static_cast<vk::u32>(batch.ownership.size());
+
+				if (___self::_dedicated() == true) {
+
+					// release copied ranges to the graphics family
+					cmd.buffer_barrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+									   VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+									   batch.ownership.data(), barriers);
+				}
+				else {
+
+					// make copies visible to vertex input of later submissions
+					cmd.memory_barrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+									   VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+									   VK_ACCESS_TRANSFER_WRITE_BIT,
+									   VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT);
+				}
+
+				// end recording
+				cmd.end();
+
+				// one submission for the whole batch, signals its serial
+				_queue.submit(cmd, _timeline, serial);
+
+				if (___self::_dedicated() == true) {
+
+					auto& acquire = _acquires[index];
+
+					acquire.reset();
+					acquire.begin();
+
+					// matching acquire, later graphics submissions are ordered after it
+					acquire.buffer_barrier(___ACQUIRE_STAGES___, ___ACQUIRE_STAGES___,
+										   batch.ownership.data(), barriers);
+					acquire.end();
+
+					// graphics queue waits for the copies, no cpu wait
+					_graphics.submit(acquire, _timeline, serial,
+									 ___ACQUIRE_STAGES___,
+									 _acquired, serial);
+
+					batch.ownership.clear();
+				}
+
+				return ++_submitted;
+			}
+
+			/* complete */
+			auto complete(const token ___tk) -> bool {
+
+				// retire signaled batches
+				___self::_poll();
+
+				return ___tk <= _completed;
+			}
+
+			/* timeline (tokens are its values, usable as gpu wait values) */
+			auto timeline(void) const noexcept -> const vulkan::timeline& {
+				return ___self::_completion();
+			}
+
+			/* wait */
+			auto wait(const token ___tk) -> void {
+
+				// token still recording
+				if (___tk > _submitted)
+					___self::submit();
+
+				while (_completed < ___tk && _completed < _submitted)
+					___self::_retire_oldest();
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* poll */
+			auto _poll(void) -> void {
+
+				if (_completed == _submitted)
+					return;
+
+				// batches signal in submission order, one query retires all
+				const token reached = ___self::_completion().completed();
+
+				while (_completed < _submitted && _completed < reached)
+					___self::_retire();
+			}
+
+			/* retire oldest */
+			auto _retire_oldest(void) -> void {
+
+				// block on oldest batch in flight
+				___self::_completion().wait(_completed + 1U);
+
+				___self::_retire();
+			}
+
+			/* retire */
+			auto _retire(void) noexcept -> void {
+
+				___batch& batch = _batches[_completed % ___BATCHES___];
+
+				// release ring space
+				_size -= batch.bytes;
+
+				batch.bytes  = 0U;
+				batch.copies = 0U;
+
+				++_completed;
+
+				// empty ring restarts at zero, avoids wrap padding
+				if (_size == 0U)
+					_head = 0U;
+			}
+
+			/* dedicated (copies run on another queue family) */
+			auto _dedicated(void) const noexcept -> bool {
+				return _queue.family() != _graphics.family();
+			}
+
+			/* completion (last timeline signaled by a batch) */
+			auto _completion(void) const noexcept -> const vulkan::timeline& {
+				return ___self::_dedicated() == true ? _acquired : _timeline;
+			}
+
+			/* release (copied range changes queue family on submit) */
+			auto _release(const vk::buffer& ___buffer,
+						  const size_type ___offset,
+						  const size_type ___size) -> void {
+
+				if (___self::_dedicated() == false)
+					return;
+
+				_batches[_submitted % ___BATCHES___].ownership.push_back(vk::buffer_memory_barrier{
+					.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+					.pNext               = nullptr,
+					// release half
+					.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+					// acquire half
+					.dstAccessMask       = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT
+										 | VK_ACCESS_TRANSFER_READ_BIT,
+					.srcQueueFamilyIndex = _queue.family(),
+					.dstQueueFamilyIndex = _graphics.family(),
+					.buffer              = ___buffer,
+					.offset              = ___offset,
+					.size                = ___size
+				});
+			}
+
+			/* recording */
+			auto _recording(void) const noexcept -> bool {
+
+				// slot still in flight, nothing is recording
+				if (_submitted - _completed == ___BATCHES___)
+					return false;
+
+				return _batches[_submitted % ___BATCHES___].copies != 0U;
+			}
+
+			/* record */
+			auto _record(void) -> vulkan::command_buffer<vulkan::primary>& {
+
+				___batch& batch = _batches[_submitted % ___BATCHES___];
+				auto& cmd       = _cmds[static_cast<vk::u32>(_submitted % ___BATCHES___)];
+
+				// begin batch on first copy
+				if (batch.copies++ == 0U) {
+					cmd.reset();
+					cmd.begin();
+				}
+
+				return cmd;
+			}
+
+			/* stage */
+			auto _stage(const vk::u8* ___src, const size_type ___bytes) -> size_type {
+
+				size_type offset;
+
+				// reserve ring space, reclaiming batches when full
+				while (___self::_reserve(___bytes, offset) == false) {
+
+					// flush current batch
+					if (___self::_recording() == true)
+						___self::submit();
+
+					___self::_retire_oldest();
+				}
+
+				// plain copy into persistently mapped ring
+				rx::memcpy(static_cast<vk::u8*>(_ring.data) + offset, ___src, ___bytes);
+
+				return offset;
+			}
+
+			/* reserve */
+			auto _reserve(const size_type ___bytes, size_type& ___offset) noexcept -> bool {
+
+				// recording batch slot still in flight
+				if (_submitted - _completed == ___BATCHES___)
+					return false;
+
+				size_type offset = (_head + ___RING_ALIGN___ - 1U) & ~static_cast<size_type>(___RING_ALIGN___ - 1U);
+
+				// wrap to ring start
+				if (offset + ___bytes > ___RING_SIZE___)
+					offset = 0U;
+
+				// padding lost at ring end or alignment
+				const size_type need = (offset >= _head ? offset - _head : ___RING_SIZE___ - _head) + ___bytes;
+
+				if (_size + need > ___RING_SIZE___)
+					return false;
+
+				_head  = offset + ___bytes;
+				_size += need;
+
+				_batches[_submitted % ___BATCHES___].bytes += need;
+
+				___offset = offset;
+				return true;
+			}
+
+	}; // class uploader
+
+} // namespace vulkan
+
+#endif // ___RENDERX_VULKAN_UPLOADER___
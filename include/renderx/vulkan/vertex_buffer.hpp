@@ -53,7 +53,7 @@ namespace vulkan {
 			/* vector constructor */
 			template <typename... ___params>
 			vertex_buffer(const vk::vector<engine::vertex<___params...>>& vertices)
-			: _buffer(sizeof(engine::vertex<___params...>) * vertices.size(), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT),
+			: _buffer(sizeof(engine::vertex<___params...>) * vertices.size(), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT),
 			  _count((vk::u32)vertices.size()) {
 			}
 
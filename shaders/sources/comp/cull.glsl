@@ -0,0 +1,115 @@
+#version 450
+
+// -- work group --------------------------------------------------------------
+
+layout(local_size_x = 64) in;
+
+
+// -- uniform -----------------------------------------------------------------
+
+layout(set = 0, binding = 0) uniform camera_object {
+	mat4 view_projection;
+} camera;
+
+
+// -- storage -----------------------------------------------------------------
+
+struct object_data {
+	mat4  model;
+	vec4  sphere; // model space center, radius
+	uint  index_count;
+	uint  first_index;
+	int   vertex_offset;
+	uint  padding;
+};
+
+struct draw_command {
+	uint index_count;
+	uint instance_count;
+	uint first_index;
+	int  vertex_offset;
+	uint first_instance;
+};
+
+layout(std430, set = 0, binding = 1) readonly buffer object_buffer {
+	object_data objects[];
+};
+
+layout(std430, set = 0, binding = 2) writeonly buffer command_buffer {
+	draw_command commands[];
+};
+
+layout(std430, set = 0, binding = 3) buffer count_buffer {
+	uint draw_count;
+};
+
+layout(std430, set = 0, binding = 4) writeonly buffer instance_buffer {
+	mat4 instances[];
+};
+
+
+// -- push constant -----------------------------------------------------------
+
+layout(push_constant) uniform cull_object {
+	uint object_count;
+	uint compact; // 1: visible draws packed and counted, 0: culled draws get no instance
+} cull;
+
+
+// -- frustum -----------------------------------------------------------------
+
+bool visible(vec3 center, float radius) {
+
+	const mat4 m = camera.view_projection;
+
+	const vec4 r0 = vec4(m[0][0], m[1][0], m[2][0], m[3][0]);
+	const vec4 r1 = vec4(m[0][1], m[1][1], m[2][1], m[3][1]);
+	const vec4 r2 = vec4(m[0][2], m[1][2], m[2][2], m[3][2]);
+	const vec4 r3 = vec4(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+	// left, right, bottom, top, near (depth 0), far
+	const vec4 planes[6] = vec4[6](r3 + r0, r3 - r0, r3 + r1, r3 - r1, r2, r3 - r2);
+
+	for (int i = 0; i < 6; ++i) {
+
+		const vec4 p = planes[i] / length(planes[i].xyz);
+
+		if (dot(p.xyz, center) + p.w < -radius)
+			return false;
+	}
+
+	return true;
+}
+
+
+void main() {
+
+	const uint i = gl_GlobalInvocationID.x;
+
+	if (i >= cull.object_count)
+		return;
+
+	const object_data o = objects[i];
+
+	// world space sphere, radius grows with the largest scale
+	const vec3  center = (o.model * vec4(o.sphere.xyz, 1.0)).xyz;
+	const float scale  = max(max(length(o.model[0].xyz), length(o.model[1].xyz)), length(o.model[2].xyz));
+
+	const bool keep = visible(center, o.sphere.w * scale);
+
+	if (cull.compact != 0u) {
+
+		if (keep == false)
+			return;
+
+		const uint slot = atomicAdd(draw_count, 1u);
+
+		// first instance selects the model in the instance stream
+		commands[slot]  = draw_command(o.index_count, 1u, o.first_index, o.vertex_offset, slot);
+		instances[slot] = o.model;
+	}
+	else {
+		commands[i]  = draw_command(o.index_count, keep ? 1u : 0u, o.first_index, o.vertex_offset, i);
+		instances[i] = o.model;
+	}
+}
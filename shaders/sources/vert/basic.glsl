@@ -2,18 +2,9 @@
 
 // -- uniform -----------------------------------------------------------------
 
-//layout(binding = 0) uniform uniform_buffer_object {
-//	mat4 model;
-//	mat4 view;
-//	mat4 proj;
-//} ubo;
-
-
-// -- push constant -----------------------------------------------------------
-
-layout(push_constant) uniform push_constant_object {
-	mat4 model;
-} pco;
+layout(set = 0, binding = 0) uniform camera_object {
+	mat4 view_projection;
+} camera;
 
 
 // -- input -------------------------------------------------------------------
@@ -21,6 +12,9 @@ layout(push_constant) uniform push_constant_object {
 layout(location = 0) in vec3 in_position;
 layout(location = 1) in vec3 in_color;
 
+// per-instance (binding 1, locations 2 to 5)
+layout(location = 2) in mat4 in_model;
+
 
 // -- output ------------------------------------------------------------------
 
@@ -32,6 +26,6 @@ out gl_PerVertex {
 
 void main() {
 	//gl_Position = vec4(in_position, 1.0);
-	gl_Position = pco.model * vec4(in_position, 1.0);
+	gl_Position = camera.view_projection * in_model * vec4(in_position, 1.0);
     frag_color = in_color;
 }
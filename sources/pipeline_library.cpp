@@ -1,10 +1,311 @@
 #include "engine/vulkan/pipeline_library.hpp"
 
 
+// -- private functions -------------------------------------------------------
+
+/* append (raw bytes of trivial value) */
+template <typename ___type>
+static auto ___append(std::vector<vk::u8>& ___out, const ___type& ___value) -> void {
+	const auto* bytes = reinterpret_cast<const vk::u8*>(&___value);
+	___out.insert(___out.end(), bytes, bytes + sizeof(___type));
+}
+
 
 // -- public lifecycle --------------------------------------------------------
 
-/* default constructor */
-//vulkan::pipeline_library::pipeline_library(void)
-//: _map{} {
-//}
+/* shader library constructor */
+vulkan::pipeline_library::pipeline_library(const engine::shader_library& ___shaders)
+: _shaders{___shaders}, _map{}, _fallback{}, _retired{}, _rebuilding{0U},
+  _hits{0U}, _misses{0U}, _compiler{} {
+
+	// load the shared cache here, workers only read it
+	static_cast<void>(vulkan::pipeline_cache::underlying());
+}
+
+
+// -- public methods ----------------------------------------------------------
+
+/* fallback */
+auto vulkan::pipeline_library::fallback(const handle& ___handle) noexcept -> void {
+	_fallback = ___handle;
+}
+
+/* resolve */
+auto vulkan::pipeline_library::resolve(const handle& ___handle) const noexcept -> const vulkan::pipeline* {
+
+	if (___handle.ready() == true)
+		return &___handle.get();
+
+	// still compiling or failed, never stall the frame
+	if (_fallback.ready() == true)
+		return &_fallback.get();
+
+	return nullptr;
+}
+
+/* rebuild */
+auto vulkan::pipeline_library::rebuild(const vk::shader_stage_flag_bits ___stage,
+									   const std::string& ___name) -> size_type {
+
+	size_type count = 0U;
+
+	for (auto& [hash, entries] : _map) {
+		for (auto& entry : entries) {
+
+			const bool uses = (___stage == VK_SHADER_STAGE_VERTEX_BIT   && entry->state.vertex   == ___name)
+						   || (___stage == VK_SHADER_STAGE_FRAGMENT_BIT && entry->state.fragment == ___name);
+
+			// never compiled or already rebuilding, nothing to replace yet
+			if (uses == false
+			 || entry->status.load(std::memory_order_acquire) != ___READY___
+			 || entry->staging.load(std::memory_order_acquire) != ___IDLE___)
+				continue;
+
+			entry->staging.store(___PENDING___, std::memory_order_relaxed);
+
+			_compiler.submit(&___self::_restage, entry.get());
+
+			++count;
+		}
+	}
+
+	_rebuilding += count;
+
+	return count;
+}
+
+/* update */
+auto vulkan::pipeline_library::update(const vk::u64& ___submitted,
+									  const vk::u64& ___completed) -> bool {
+
+	bool swapped = false;
+
+	if (_rebuilding != 0U) {
+
+		for (auto& [hash, entries] : _map) {
+			for (auto& entry : entries) {
+
+				const vk::u32 staging = entry->staging.load(std::memory_order_acquire);
+
+				if (staging == ___READY___) {
+
+					// frames up to submitted may still bind the old pipeline
+					_retired.push_back(___retired{std::move(entry->pipeline), ___submitted});
+
+					entry->pipeline = std::move(entry->staged);
+					swapped = true;
+				}
+				else if (staging != ___FAILED___)
+					continue;
+
+				// failed rebuild keeps the current pipeline
+				entry->staging.store(___IDLE___, std::memory_order_relaxed);
+				--_rebuilding;
+			}
+		}
+	}
+
+	// no wait idle, only pipelines of completed frames are released
+	std::erase_if(_retired, [&___completed](const ___retired& ___old) noexcept -> bool {
+		return ___old.value <= ___completed;
+	});
+
+	return swapped;
+}
+
+/* drain */
+auto vulkan::pipeline_library::drain(void) -> void {
+	_compiler.drain();
+}
+
+/* clear */
+auto vulkan::pipeline_library::clear(void) -> void {
+
+	// workers write into entries
+	_compiler.drain();
+
+	_fallback   = handle{};
+	_rebuilding = 0U;
+	_retired.clear();
+	_map.clear();
+}
+
+
+// -- public accessors --------------------------------------------------------
+
+/* hits */
+auto vulkan::pipeline_library::hits(void) const noexcept -> size_type {
+	return _hits;
+}
+
+/* misses */
+auto vulkan::pipeline_library::misses(void) const noexcept -> size_type {
+	return _misses;
+}
+
+/* size */
+auto vulkan::pipeline_library::size(void) const noexcept -> size_type {
+
+	size_type count = 0U;
+
+	for (const auto& [hash, entries] : _map)
+		count += static_cast<size_type>(entries.size());
+
+	return count;
+}
+
+
+// -- private methods ---------------------------------------------------------
+
+/* serialize */
+auto vulkan::pipeline_library::_serialize(const vk::render_pass& ___render_pass,
+										  const vk::descriptor_set_layout& ___set_layout,
+										  const vulkan::pipeline_state& ___state,
+										  const vk::pipeline_vertex_input_state_info& ___input) const -> std::vector<vk::u8> {
+
+	std::vector<vk::u8> out;
+	out.reserve(256U);
+
+	// shader modules (by name, a reloaded module keeps its entries,
+	// lookup throws here on the calling thread when a module is missing)
+	_shaders.vertex_module(___state.vertex);
+	_shaders.fragment_module(___state.fragment);
+
+	::___append(out, static_cast<vk::u64>(___state.vertex.size()));
+	out.insert(out.end(), ___state.vertex.begin(), ___state.vertex.end());
+
+	::___append(out, static_cast<vk::u64>(___state.fragment.size()));
+	out.insert(out.end(), ___state.fragment.begin(), ___state.fragment.end());
+
+	// specialization (entries and data, not the pointer)
+	if (const auto* spec = ___state.specialization; spec != nullptr) {
+
+		::___append(out, spec->mapEntryCount);
+
+		for (vk::u32 i = 0U; i < spec->mapEntryCount; ++i) {
+			::___append(out, spec->pMapEntries[i].constantID);
+			::___append(out, spec->pMapEntries[i].offset);
+			::___append(out, static_cast<vk::u64>(spec->pMapEntries[i].size));
+		}
+
+		::___append(out, static_cast<vk::u64>(spec->dataSize));
+
+		const auto* data = static_cast<const vk::u8*>(spec->pData);
+		out.insert(out.end(), data, data + spec->dataSize);
+	}
+	else
+		::___append(out, vk::u32{0U});
+
+	// vertex layout (field by field, no padding bytes)
+	::___append(out, ___input.vertexBindingDescriptionCount);
+
+	for (vk::u32 i = 0U; i < ___input.vertexBindingDescriptionCount; ++i) {
+		const auto& binding = ___input.pVertexBindingDescriptions[i];
+		::___append(out, binding.binding);
+		::___append(out, binding.stride);
+		::___append(out, binding.inputRate);
+	}
+
+	::___append(out, ___input.vertexAttributeDescriptionCount);
+
+	for (vk::u32 i = 0U; i < ___input.vertexAttributeDescriptionCount; ++i) {
+		const auto& attribute = ___input.pVertexAttributeDescriptions[i];
+		::___append(out, attribute.location);
+		::___append(out, attribute.binding);
+		::___append(out, attribute.format);
+		::___append(out, attribute.offset);
+	}
+
+	// fixed function state
+	::___append(out, ___state.topology);
+	::___append(out, ___state.polygon);
+	::___append(out, ___state.cull);
+	::___append(out, ___state.front);
+	::___append(out, ___state.depth_test);
+	::___append(out, ___state.depth_write);
+	::___append(out, ___state.depth_compare);
+	::___append(out, ___state.blend);
+
+	// compatibility
+	::___append(out, ___render_pass);
+	::___append(out, ___set_layout);
+
+	return out;
+}
+
+/* acquire */
+auto vulkan::pipeline_library::_acquire(const vk::render_pass& ___render_pass,
+										const vk::descriptor_set_layout& ___set_layout,
+										const vulkan::pipeline_state& ___state,
+										const vk::pipeline_vertex_input_state_info& ___input,
+										const ___builder ___build,
+										bool& ___missed) -> ___entry& {
+
+	auto key = ___self::_serialize(___render_pass, ___set_layout, ___state, ___input);
+
+	const key_type hash = rx::fnv1a(key.data(), key.size());
+
+	auto& entries = _map[hash];
+
+	// hash collision, full state decides
+	for (const auto& entry : entries) {
+		if (entry->key == key) {
+			++_hits;
+			___missed = false;
+			return *entry;
+		}
+	}
+
+	++_misses;
+	___missed = true;
+
+	auto entry = std::make_unique<___entry>();
+
+	entry->key         = std::move(key);
+	entry->state       = ___state;
+	entry->render_pass = ___render_pass;
+	entry->set_layout  = ___set_layout;
+	entry->build       = ___build;
+	entry->shaders     = &_shaders;
+
+	entries.push_back(std::move(entry));
+
+	return *entries.back();
+}
+
+
+// -- private static methods --------------------------------------------------
+
+/* compile */
+auto vulkan::pipeline_library::_compile(void* ___context) noexcept -> void {
+
+	auto& entry = *static_cast<___entry*>(___context);
+
+	try {
+		entry.pipeline = entry.build(*entry.shaders, entry.render_pass,
+									 entry.set_layout, entry.state);
+		entry.status.store(___READY___, std::memory_order_release);
+	}
+	catch (...) {
+		entry.error = std::current_exception();
+		entry.status.store(___FAILED___, std::memory_order_release);
+	}
+
+	// wake get() callers blocked on this entry
+	entry.status.notify_all();
+}
+
+/* restage */
+auto vulkan::pipeline_library::_restage(void* ___context) noexcept -> void {
+
+	auto& entry = *static_cast<___entry*>(___context);
+
+	try {
+		entry.staged = entry.build(*entry.shaders, entry.render_pass,
+								   entry.set_layout, entry.state);
+		entry.staging.store(___READY___, std::memory_order_release);
+	}
+	catch (...) {
+		entry.staging.store(___FAILED___, std::memory_order_release);
+	}
+}
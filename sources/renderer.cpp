@@ -20,6 +20,13 @@
 
 #include "renderx/glfw/monitor.hpp"
 
+#include <iostream>
+
+
+// instance stream holds model matrices as is
+static_assert(instance_type::stride == sizeof(glm::mat4),
+		"instance layout must match glm::mat4");
+
 
 // -- public lifecycle --------------------------------------------------------
 
@@ -27,42 +34,68 @@
 engine::renderer::renderer(void)
 :
 	_queue{},
+	_transfer{vulkan::device::transfer_family()},
 	_swapchain{},
 	_pool{VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT},
 	_cmds{_pool.underlying(), _swapchain.size()},
+	_host{},
+	_cached{},
+	_dirty{},
 	_shaders{},
+	_uniforms{_cached, _dirty, _swapchain.size()},
 	
+	_pipelines{_shaders},
+
 	_pipeline{
-		vulkan::pipeline_builder<vertex_type>::build(
-				_shaders,
-				_swapchain.render_pass().underlying())
+		_pipelines.request<layout_type>(
+				_swapchain.render_pass().underlying(),
+				_uniforms.layout())
 	},
 
 	_memory{},
-	_sync{},
+	_pacer{3U},
+	_transient{_pacer, _cached, _dirty},
+	_submission{},
 	_meshes{},
 	_objects{},
+	_draws{},
+	_instances{_host, _swapchain.size()},
 	_allocator{},
+	_uploader{_transfer, _queue, _host},
+	_defrag{_queue, _allocator, _uploader},
+	_geometry{_allocator, _defrag, 256U * 1024U, 1024U * 1024U},
+	_culler{_shaders, _allocator, _host, _uniforms},
+	_recorder{_swapchain.size()},
+	_threaded{true},
+	_retained{true},
+	_gpu_driven{false},
+	_version{0U},
+	_recorded(_swapchain.size(), 0U),
+	_image_values(_swapchain.size(), 0U),
+	_redundant{0U},
+	_watcher{},
 	_camera{}
 {
 
-	auto cuboid = rx::cube();
-
-	_meshes.emplace_back(cuboid.first, cuboid.second);
-
-	//_mesh = rx::mesh{cuboid.first, cuboid.second};
-
+	// basic pipeline stands in for variants still compiling
+	_pipelines.fallback(_pipeline);
 
-	auto alloc = _allocator.allocate_buffer(_meshes.back().vertices().underlying());
-	alloc.memcpy(cuboid.first.data());
+	auto cuboid = rx::cube();
 
+	// sub-allocate mesh in shared geometry buffers
+	_meshes.emplace_back(_geometry.add(_uploader, cuboid.first, cuboid.second));
 
-	auto alloc_index = _allocator.allocate_buffer(_meshes.back().indices().underlying());
-	alloc_index.memcpy(cuboid.second.data());
+	// index in mesh list, distinct sort keys per mesh
+	_meshes.back().id(static_cast<vk::u16>(_meshes.size() - 1U));
 
+	// flush staged copies in a single transfer submission
+	_uploader.submit();
 
 	_objects.emplace_back(_meshes.back());
 
+	// scene built, every image records once
+	___self::invalidate();
+
 	//_camera.ratio(rx::sdl::window::ratio());
 	_camera.fov(70.0f);
 	_camera.update_projection();
@@ -161,6 +194,9 @@ auto engine::renderer::run(void) -> void {
 
 	rx::umax last = rx::now();
 
+	// last pipeline cache write
+	rx::umax saved = last;
+
 
 	static vk::u32 i = 0U;
 
@@ -191,6 +227,27 @@ auto engine::renderer::run(void) -> void {
 		//_objects[0].rotation().y += 1.00f * rx::delta::time<float>();
 
 		___self::draw_frame();
+
+		const auto moved = _defrag.moved();
+
+		// compact sparse blocks (0.5 ms budget)
+		_defrag.step(500'000U);
+
+		// relocated geometry, recorded binds are stale
+		if (_defrag.moved() != moved)
+			___self::invalidate();
+
+		// release idle memory blocks
+		_allocator.collect();
+
+		// recompiled shaders, rebuilt pipelines swapped between frames
+		___self::_reload_shaders();
+
+		// persist new pipelines (every 30 seconds, no-op when unchanged)
+		if (now - saved >= 30'000'000'000U) {
+			___self::_save_pipelines();
+			saved = now;
+		}
 		//std::cout << "delta: " << rx::delta::time<float>() << " fps: " << fps << std::endl;
 
 		last = now;
@@ -204,23 +261,152 @@ auto engine::renderer::run(void) -> void {
 
 	// wait for logical device to be idle
 	vulkan::device::wait_idle();
+
+	// persist pipelines compiled this run
+	___self::_save_pipelines();
 }
 
 /* draw frame */
 auto engine::renderer::draw_frame(void) -> void {
 
-	// wait for current fence
-	_sync.wait_current_fence();
+	// wait for frame submitted frames in flight ago
+	_pacer.wait_current_frame();
 
 	vk::u32 image_index = 0U;
 
 	// here error not means program must stop
-	if (_swapchain.acquire_next_image(_sync.image_available(),
+	if (_swapchain.acquire_next_image(_pacer.image_available(),
 										image_index) == false)
 		return;
 
 
-	auto& cmd = _cmds[image_index];
+	// previous frame using this image must be done
+	___self::_wait_image(image_index);
+
+	// camera changes every frame, recorded commands only read the uniform slot
+	_uniforms.update(image_index, _camera.projection() * _camera.view());
+
+	// re-record only when the scene changed since this image was recorded
+	if (_retained == false || _recorded[image_index] != _version)
+		___self::_record(image_index);
+
+	// -- submit command buffer -----------------------------------------------
+
+	_submission.clear();
+
+	// frame batch (signals frame value on timeline)
+	_submission.wait(_pacer.image_available(), VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT)
+			   .execute(_cmds[image_index])
+			   .signal(_pacer.render_finished())
+			   .signal(_pacer.timeline(), _pacer.value());
+
+	// cached writes of the frame visible to the device (one call)
+	_dirty.flush();
+
+	// single vkQueueSubmit for every batch of the frame
+	_queue.submit(_submission);
+
+	// image in use until this value is reached
+	_image_values[image_index] = _pacer.value();
+
+	const vk::semaphore& finished = _pacer.render_finished();
+
+	// next frame (value is spent, even if present fails)
+	++_pacer;
+
+	// here error not means program must stop
+	_queue.present(_swapchain, image_index, finished);
+}
+
+/* frames in flight */
+auto engine::renderer::frames_in_flight(const vk::u32 ___frames) noexcept -> void {
+	_pacer.frames(___frames);
+}
+
+/* threaded recording */
+auto engine::renderer::threaded_recording(const bool ___enabled) noexcept -> void {
+	_threaded = ___enabled;
+}
+
+/* retained recording */
+auto engine::renderer::retained_recording(const bool ___enabled) noexcept -> void {
+	_retained = ___enabled;
+
+	// immediate recordings read the frame ring, never replay them
+	___self::invalidate();
+}
+
+/* gpu driven */
+auto engine::renderer::gpu_driven(const bool ___enabled) noexcept -> void {
+
+	// missing shader or device feature, stays on cpu batching
+	_gpu_driven = ___enabled == true && _culler.supported() == true;
+
+	___self::invalidate();
+}
+
+/* hot reload */
+auto engine::renderer::hot_reload(const bool ___enabled) -> void {
+
+	if (___enabled == false) {
+		_watcher.reset();
+		return;
+	}
+
+	if (_watcher == nullptr)
+		_watcher = std::make_unique<engine::shader_watcher>();
+}
+
+/* invalidate */
+auto engine::renderer::invalidate(void) noexcept -> void {
+	++_version;
+}
+
+/* redundant binds */
+auto engine::renderer::redundant_binds(void) const noexcept -> vk::u64 {
+	return _redundant.load(std::memory_order_relaxed);
+}
+
+/* memory stats */
+auto engine::renderer::memory_stats(void) const -> vulkan::memory_stats {
+
+	vulkan::memory_stats stats;
+
+	// gather every allocator owned by the renderer
+	_allocator.stats(stats);
+	_host.stats(stats);
+	_cached.stats(stats);
+
+	return stats;
+}
+
+
+
+// -- private methods ---------------------------------------------------------
+
+/* wait image */
+auto engine::renderer::_wait_image(const vk::u32& ___image) -> void {
+
+	// more images than frames in flight, another frame may still use it
+	// (zero when never submitted)
+	_pacer.wait(_image_values[___image]);
+}
+
+/* record */
+auto engine::renderer::_record(const vk::u32& ___image) -> void {
+
+	auto& cmd = _cmds[___image];
+
+	if (_gpu_driven == true) {
+		___self::_record_indirect(___image);
+		return;
+	}
+
+	// state sorted order for this recording
+	___self::_sort_draws();
+
+	// model matrices into this image's instance stream
+	___self::_batch_draws(___image);
 
 	// record command buffer (see flagbits)
 	cmd.reset();
@@ -228,43 +414,78 @@ auto engine::renderer::draw_frame(void) -> void {
 
 	// -- record command buffer -----------------------------------------------
 
-	// start recording
+	// start recording (no one time submit, buffer is replayed)
 	cmd.begin();
 
+	const auto& batches = _instances.batches();
+
+	// requested pipeline, fallback or none while compiling
+	const vulkan::pipeline* pipeline = _pipelines.resolve(_pipeline);
+
+	// split large scenes across worker threads
+	// (workers get batch ranges, recording cost is per draw, not per instance)
+	const bool parallel = _threaded == true
+					   && pipeline  != nullptr
+					   && batches.size() >= ___self::___PARALLEL_THRESHOLD___;
+
 	// begin render pass
 	cmd.begin_render_pass(_swapchain,
 						  _swapchain.render_pass(),
-						  _swapchain.frames()[image_index]);
+						  _swapchain.frames()[___image],
+						  parallel == true ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+										   : VK_SUBPASS_CONTENTS_INLINE);
 
-	// dynamic viewport
-	cmd.set_viewport(_swapchain);
+	const vk::descriptor_set& camera = _uniforms.set(___image);
 
-	// dynamic scissor
-	cmd.set_scissor(_swapchain);
+	// records batches [first, last), no state is inherited by secondaries
+	auto draws = [this, &camera, &batches, pipeline](const auto& ___cmd,
+													 const vk::u32 ___first,
+													 const vk::u32 ___last) -> void {
 
+		// drops binds equal to the current state
+		vulkan::state_tracker tracker{___cmd};
 
-	{ // -- for each mesh -----------------------------------------------------
+		// dynamic viewport
+		tracker.set_viewport(_swapchain);
+
+		// dynamic scissor
+		tracker.set_scissor(_swapchain);
+
+		for (vk::u32 i = ___first; i < ___last; ++i) {
+
+			const auto& batch = batches[i];
+
+			// per-batch state, only changes reach the command buffer
+			tracker.bind_pipeline(*pipeline);
+			tracker.bind_descriptor_set(*pipeline, camera);
+			_geometry.bind(tracker);
+			_instances.bind(tracker, layout_type::instance_binding());
 
-		for (const auto& object : _objects) {
+			// one instanced draw per run of objects sharing a mesh
+			batch.mesh->draw(tracker, batch.count, batch.first);
+		}
+
+		_redundant.fetch_add(tracker.dropped(), std::memory_order_relaxed);
+	};
 
-			// bind pipeline
-			cmd.bind_pipeline(_pipeline);
 
-			// bind vertex buffer
-			cmd.bind_vertex_buffer(object.mesh().vertices());
+	{ // -- for each mesh -----------------------------------------------------
 
-			// bind index buffer
-			cmd.bind_index_buffer(object.mesh().indices());
+		// nothing to draw with yet, render pass only clears
+		const auto count = pipeline != nullptr ? static_cast<vk::u32>(batches.size()) : 0U;
 
-			// push constants
-			cmd.push_constants(_pipeline, 
-					_camera.projection() *
-					_camera.view() *
-					object.model());
+		if (parallel == true) {
 
-			// draw indexed
-			cmd.draw_indexed(object.mesh().indices().count());
+			// per-worker secondaries of this image, stitched in order
+			_recorder.record(___image,
+							 _swapchain.render_pass(),
+							 _swapchain.frames()[___image],
+							 count, draws);
+
+			_recorder.execute(cmd);
 		}
+		else
+			draws(cmd, 0U, count);
 	}
 
 	// end render pass
@@ -273,30 +494,172 @@ auto engine::renderer::draw_frame(void) -> void {
 	// end recording
 	cmd.end();
 
-	// -- submit command buffer -----------------------------------------------
+	// recorded without the requested pipeline, record again next frame
+	if (_pipeline.pending() == false)
+		_recorded[___image] = _version;
+}
 
-	// reset fence
-	_sync.reset_current_fence();
+/* record indirect */
+auto engine::renderer::_record_indirect(const vk::u32& ___image) -> void {
 
-	// submit command buffers
-	_queue.submit(_sync.image_available(),
-				  _sync.render_finished(),
-				  _sync.fence(),
-				  cmd);
+	auto& cmd = _cmds[___image];
 
-	// here error not means program must stop
-	if (_queue.present(_swapchain, image_index,
-					   _sync.render_finished()
-				) == false)
-		return;
+	// image value waited, its culling buffers are free
+	_culler.upload(___image, _objects);
+
+	cmd.reset();
+
+	// start recording (no one time submit, buffer is replayed)
+	cmd.begin();
+
+	// culling reads the camera slot of this image, replays stay valid
+	_culler.cull(cmd, ___image);
+
+	cmd.begin_render_pass(_swapchain,
+						  _swapchain.render_pass(),
+						  _swapchain.frames()[___image],
+						  VK_SUBPASS_CONTENTS_INLINE);
+
+	// requested pipeline, fallback or none while compiling
+	if (const vulkan::pipeline* pipeline = _pipelines.resolve(_pipeline);
+		pipeline != nullptr) {
+
+		vulkan::state_tracker tracker{cmd};
+
+		tracker.set_viewport(_swapchain);
+		tracker.set_scissor(_swapchain);
+		tracker.bind_pipeline(*pipeline);
+		tracker.bind_descriptor_set(*pipeline, _uniforms.set(___image));
+		_geometry.bind(tracker);
+		_culler.bind(tracker, ___image, layout_type::instance_binding());
+
+		// one indirect command per object, culled ones are skipped or empty
+		_culler.draw(cmd, ___image);
+	}
+
+	cmd.end_render_pass();
+
+	cmd.end();
+
+	// recorded without the requested pipeline, record again next frame
+	if (_pipeline.pending() == false)
+		_recorded[___image] = _version;
+}
+
+/* save pipelines */
+auto engine::renderer::_save_pipelines(void) noexcept -> void {
+
+	// disk full or read only, compiled pipelines stay in memory
+	try {
+		vulkan::pipeline_cache::save();
+	}
+	catch (const vk::exception& except) {
+		except.what();
+	}
+	catch (const std::exception& except) {
+		std::cerr << "pipeline cache: " << except.what() << std::endl;
+	}
+}
+
+/* reload shaders */
+auto engine::renderer::_reload_shaders(void) -> void {
+
+	if (_watcher != nullptr) {
+
+		const auto paths = _watcher->take();
+
+		// queued compiles may still read the modules being replaced
+		if (paths.empty() == false)
+			_pipelines.drain();
+
+		for (const auto& path : paths) {
+
+			const auto name = std::filesystem::path{path}.stem().string();
+
+			try {
+				const auto stage = _shaders.reload(path);
+
+				if (stage != VK_SHADER_STAGE_COMPUTE_BIT)
+					_pipelines.rebuild(stage, name);
+
+				// compute pipelines are not in the library, the culler owns its own
+				else if (name == "cull") {
+
+					// submitted culling dispatches bind the old pipeline,
+					// rare development path, wait every submitted frame
+					_pacer.wait(_pacer.value() - 1U);
+					_culler.rebuild(_shaders);
+					___self::invalidate();
+				}
+
+				continue;
+			}
+			// invalid spirv, previous module stays in use
+			catch (const vk::exception& except) {
+				std::cerr << "shader reload failed: " << path << std::endl;
+				except.what();
+			}
+			catch (const std::runtime_error& except) {
+				std::cerr << "shader reload failed: " << path << ": " << except.what() << std::endl;
+			}
+
+			// broken culling shader, draw with cpu batching until restart
+			if (name == "cull" && _gpu_driven == true) {
+				_gpu_driven = false;
+				___self::invalidate();
+			}
+		}
+	}
 
-	// next frame
-	++_sync;
+	// frames up to the last submitted value may bind replaced pipelines
+	if (_pipelines.update(_pacer.value() - 1U, _pacer.timeline().completed()) == true)
+		___self::invalidate();
 }
 
+/* sort draws */
+auto engine::renderer::_sort_draws(void) -> void {
+
+	_draws.clear();
+	_draws.reserve(static_cast<rx::render_queue::size_type>(_objects.size()));
+
+	const glm::mat4& view = _camera.view();
+
+	for (vk::u32 i = 0U; i < static_cast<vk::u32>(_objects.size()); ++i) {
+
+		const rx::object& object = _objects[i];
+
+		// view space depth of object origin
+		const float depth = (view * glm::vec4{object.position(), 1.0f}).z;
+
+		// single opaque pass / pipeline / material for now,
+		// meshes grouped by their id (first index would be truncated to 16 bits)
+		_draws.push(rx::render_queue::key(0U, 0U, 0U,
+					object.mesh().id(),
+					rx::render_queue::quantize_depth(depth, _camera.near(), _camera.far())), i);
+	}
+
+	_draws.sort();
+}
+
+/* batch draws */
+auto engine::renderer::_batch_draws(const vk::u32& ___image) -> void {
+
+	const auto count = static_cast<vk::u32>(_draws.size());
+	const auto bytes = sizeof(glm::mat4) * static_cast<vk::device_size>(count);
+
+	// recorded every frame, stream from the ring slice of the waited frame
+	if (_retained == false && _transient.available(alignof(glm::mat4)) >= bytes)
+		_instances.begin(_transient, count);
+
+	// image value waited, its stream is free
+	else
+		_instances.begin(___image, count);
+
+	for (const auto& item : _draws) {
+
+		const rx::object& object = _objects[item.payload];
+
+		_instances.push(object.mesh(), object.model());
+	}
+}
 
-// this for when swapchain image number is inferior to MAX_FRAMES_IN_FLIGHT
-// Vérifier si une frame précédente est en train d'utiliser cette image (il y a une fence à attendre)
-//if (imagesInFlight[imageIndex] != VK_NULL_HANDLE) {
-//	vkWaitForFences(device, 1, &imagesInFlight[imageIndex], VK_TRUE, UINT64_MAX);
-//}
@@ -0,0 +1,212 @@
+#include "engine/shader_watcher.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
+
+#if defined(ENGINE_OS_LINUX)
+#	include <poll.h>
+#	include <spawn.h>
+#	include <stdio.h>
+#	include <sys/inotify.h>
+#	include <sys/wait.h>
+#	include <unistd.h>
+
+extern char** environ;
+#endif
+
+
+// -- private constants -------------------------------------------------------
+
+/* glsl sources (one directory per stage, as in shaders/make.sh) */
+static constexpr const char* ___sources = "shaders/sources/";
+
+/* spirv output */
+static constexpr const char* ___spirv   = "shaders/spirv/";
+
+
+// -- public lifecycle --------------------------------------------------------
+
+/* default constructor */
+engine::shader_watcher::shader_watcher(void)
+: _fd{-1}, _stages{}, _compiled{}, _mutex{}, _stop{false}, _thread{} {
+
+#if defined(ENGINE_OS_LINUX)
+
+	_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+	if (_fd == -1)
+		throw std::runtime_error{"failed to initialize inotify"};
+
+	try {
+
+		// closed after write, or renamed in (editors saving through a temp file)
+		for (const auto& entry : std::filesystem::directory_iterator{___sources}) {
+
+			if (entry.is_directory() == false)
+				continue;
+
+			const int wd = ::inotify_add_watch(_fd, entry.path().c_str(),
+											   IN_CLOSE_WRITE | IN_MOVED_TO);
+
+			if (wd == -1)
+				throw std::runtime_error{"failed to watch shader directory"};
+
+			_stages[wd] = entry.path().filename().string();
+		}
+	}
+	catch (...) {
+		::close(_fd);
+		throw;
+	}
+
+	_thread = std::thread{&___self::_run, this};
+
+#else
+	throw std::runtime_error{"shader hot reload requires inotify"};
+#endif
+}
+
+/* destructor */
+engine::shader_watcher::~shader_watcher(void) noexcept {
+
+	_stop.store(true, std::memory_order_relaxed);
+
+	// loop polls with a timeout, sees the flag
+	if (_thread.joinable() == true)
+		_thread.join();
+
+#if defined(ENGINE_OS_LINUX)
+	if (_fd != -1)
+		::close(_fd);
+#endif
+}
+
+
+// -- public methods ----------------------------------------------------------
+
+/* take */
+auto engine::shader_watcher::take(void) -> std::vector<std::string> {
+
+	std::vector<std::string> compiled;
+
+	const std::lock_guard<std::mutex> lock{_mutex};
+
+	compiled.swap(_compiled);
+
+	return compiled;
+}
+
+
+// -- private methods ---------------------------------------------------------
+
+/* run */
+auto engine::shader_watcher::_run(void) -> void {
+
+#if defined(ENGINE_OS_LINUX)
+
+	::pollfd descriptor {
+		.fd      = _fd,
+		.events  = POLLIN,
+		.revents = 0
+	};
+
+	alignas(::inotify_event) char buffer[4096U];
+
+	while (_stop.load(std::memory_order_relaxed) == false) {
+
+		if (::poll(&descriptor, 1U, 100) <= 0)
+			continue;
+
+		const ::ssize_t size = ::read(_fd, buffer, sizeof(buffer));
+
+		if (size <= 0)
+			continue;
+
+		// editors emit several events per save, compile each file once
+		std::vector<std::pair<std::string, std::string>> changed;
+
+		for (const char* it = buffer; it < buffer + size;) {
+
+			const auto* event = reinterpret_cast<const ::inotify_event*>(it);
+
+			it += sizeof(::inotify_event) + event->len;
+
+			if (event->len == 0U)
+				continue;
+
+			const std::string file{event->name};
+
+			if (file.ends_with(".glsl") == false)
+				continue;
+
+			const auto stage = _stages.find(event->wd);
+
+			if (stage == _stages.end())
+				continue;
+
+			std::pair<std::string, std::string> source{stage->second, file};
+
+			if (std::find(changed.begin(), changed.end(), source) == changed.end())
+				changed.push_back(std::move(source));
+		}
+
+		for (const auto& [stage, file] : changed)
+			___self::_compile(stage, file);
+	}
+
+#endif
+}
+
+/* compile */
+auto engine::shader_watcher::_compile([[maybe_unused]] const std::string& ___stage,
+									  [[maybe_unused]] const std::string& ___file) -> void {
+
+#if defined(ENGINE_OS_LINUX)
+
+	const std::string name   = ___file.substr(0U, ___file.size() - sizeof(".glsl") + 1U);
+	const std::string source = ___sources + ___stage + "/" + ___file;
+	const std::string output = ___spirv   + ___stage;
+	const std::string spirv  = output + "/" + name + ".spv";
+	const std::string temp   = spirv + ".tmp";
+	const std::string flag   = "-fshader-stage=" + ___stage;
+
+	std::error_code error;
+	std::filesystem::create_directories(output, error);
+
+	char* argv[] {
+		const_cast<char*>("glslc"),
+		const_cast<char*>(flag.c_str()),
+		const_cast<char*>(source.c_str()),
+		const_cast<char*>("-o"),
+		const_cast<char*>(temp.c_str()),
+		nullptr
+	};
+
+	::pid_t pid = 0;
+
+	if (::posix_spawnp(&pid, "glslc", nullptr, nullptr, argv, environ) != 0)
+		return;
+
+	int status = 0;
+
+	if (::waitpid(pid, &status, 0) == -1)
+		return;
+
+	// glslc reports errors on stderr, previous spirv stays in use
+	if (WIFEXITED(status) == false || WEXITSTATUS(status) != 0) {
+		::unlink(temp.c_str());
+		return;
+	}
+
+	// loader never sees a partial file
+	if (::rename(temp.c_str(), spirv.c_str()) == -1)
+		return;
+
+	const std::lock_guard<std::mutex> lock{_mutex};
+
+	_compiled.push_back(spirv);
+
+#endif
+}
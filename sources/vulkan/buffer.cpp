@@ -5,13 +5,13 @@
 
 /* default constructor */
 vulkan::buffer::buffer(void) noexcept
-: _buffer{nullptr} {
+: _buffer{nullptr}, _size{0U}, _usage{0U} {
 }
 
 /* parameters constructor */
 vulkan::buffer::buffer(const vk::device_size& ___size,
 					   const vk::buffer_usage_flags& ___usage)
-/* uninitialized buffer */ {
+: /* uninitialized buffer */ _size{___size}, _usage{___usage} {
 
 	// create buffer info
 	vk::buffer_info info {
@@ -41,7 +41,7 @@ vulkan::buffer::buffer(const vk::device_size& ___size,
 
 /* move constructor */
 vulkan::buffer::buffer(___self&& ___ot) noexcept
-: _buffer{___ot._buffer} {
+: _buffer{___ot._buffer}, _size{___ot._size}, _usage{___ot._usage} {
 
 	// invalidate other
 	___ot._buffer = nullptr;
@@ -76,6 +76,8 @@ auto vulkan::buffer::operator=(___self&& ___ot) noexcept -> ___self& {
 
 	// move assign
 	_buffer = ___ot._buffer;
+	_size   = ___ot._size;
+	_usage  = ___ot._usage;
 	___ot._buffer = nullptr;
 
 	// done
@@ -89,3 +91,27 @@ auto vulkan::buffer::operator=(___self&& ___ot) noexcept -> ___self& {
 auto vulkan::buffer::underlying(void) const noexcept -> const vk::buffer& {
 	return _buffer;
 }
+
+/* size */
+auto vulkan::buffer::size(void) const noexcept -> vk::device_size {
+	return _size;
+}
+
+/* usage */
+auto vulkan::buffer::usage(void) const noexcept -> vk::buffer_usage_flags {
+	return _usage;
+}
+
+
+// -- public modifiers --------------------------------------------------------
+
+/* release */
+auto vulkan::buffer::release(void) noexcept -> vk::buffer {
+
+	const vk::buffer handle = _buffer;
+
+	// invalidate
+	_buffer = nullptr;
+
+	return handle;
+}
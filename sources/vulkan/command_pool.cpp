@@ -5,6 +5,12 @@
 
 /* flags constructor */
 vulkan::command_pool::command_pool(const vk::command_pool_create_flags& ___flags)
+: ___self{___flags, vulkan::device::family()} {
+}
+
+/* flags / family constructor */
+vulkan::command_pool::command_pool(const vk::command_pool_create_flags& ___flags,
+								   const vk::u32& ___family)
 : _pool{} {
 
 	// create info
@@ -12,7 +18,7 @@ vulkan::command_pool::command_pool(const vk::command_pool_create_flags& ___flags
 		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
 		.pNext = nullptr,
 		.flags = ___flags,
-		.queueFamilyIndex = vulkan::device::family()
+		.queueFamilyIndex = ___family
 	};
 
 	// create command pool
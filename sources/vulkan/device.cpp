@@ -9,6 +9,8 @@
 
 #include "engine/os.hpp"
 
+#include <vector>
+
 
 
 // -- private static methods --------------------------------------------------
@@ -26,7 +28,10 @@ auto vulkan::device::_shared(void) -> ___self& {
 vulkan::device::device(void)
 : _ldevice{nullptr},
   _pdevice{nullptr},
-  _family{0U}, _priority{1.0f} {
+  _family{0U}, _transfer_family{0U}, _priority{1.0f},
+  _memory_budget{false},
+  _draw_indirect_count{false},
+  _timeline_semaphore{false} {
 
 	// get surface
 	auto& surface = vulkan::surface::shared();
@@ -37,8 +42,26 @@ vulkan::device::device(void)
 	// get queue family index
 	_family  = _pdevice.find_queue_family(surface, VK_QUEUE_GRAPHICS_BIT);
 
-	// create device queue info
-	const auto queue_info = vulkan::queue::info(_family, _priority);
+	// transfer only family (dma engine), else any family without graphics
+	_transfer_family = _pdevice.find_dedicated_queue_family(VK_QUEUE_TRANSFER_BIT,
+			VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT);
+
+	if (_transfer_family == VK_QUEUE_FAMILY_IGNORED)
+		_transfer_family = _pdevice.find_dedicated_queue_family(VK_QUEUE_TRANSFER_BIT,
+				VK_QUEUE_GRAPHICS_BIT);
+
+	// no dedicated family, share the graphics queue
+	if (_transfer_family == VK_QUEUE_FAMILY_IGNORED)
+		_transfer_family = _family;
+
+	// create device queue infos (one queue per distinct family)
+	std::vector<vk::device_queue_info> queue_infos{vulkan::queue::info(_family, _priority)};
+
+	if (_transfer_family != _family)
+		queue_infos.push_back(vulkan::queue::info(_transfer_family, _priority));
+
+	// culling is recorded in the frame command buffer (replayed by retained
+	// recording), no async compute queue is created
 
 	// get physical device features
 	const auto features = _pdevice.features();
@@ -52,6 +75,44 @@ vulkan::device::device(void)
 		#endif
 	};
 
+	// optional extensions
+	std::vector<const char*> enabled{extensions.data(),
+									 extensions.data() + extensions.size()};
+
+	// driver heap budget (stats only)
+	_memory_budget = _pdevice.supports_extension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+
+	if (_memory_budget == true)
+		enabled.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+
+	// gpu side draw count and timeline semaphores (core since vulkan 1.2)
+	vk::physical_device_vulkan12_features supported12 {
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+		.pNext = nullptr
+	};
+
+	vk::physical_device_features2 features2 {
+		.sType    = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+		.pNext    = &supported12,
+		.features = {}
+	};
+
+	if (_pdevice.properties().apiVersion >= VK_API_VERSION_1_2)
+		::vk_get_physical_device_features2(_pdevice, &features2);
+
+	_draw_indirect_count = supported12.drawIndirectCount == VK_TRUE;
+	_timeline_semaphore  = supported12.timelineSemaphore == VK_TRUE;
+
+	const vk::physical_device_vulkan12_features enabled12 {
+		.sType             = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+		.pNext             = nullptr,
+		.drawIndirectCount = supported12.drawIndirectCount,
+		.timelineSemaphore = supported12.timelineSemaphore
+	};
+
+	const bool chain12 = _draw_indirect_count == true
+					  || _timeline_semaphore  == true;
+
 	// get validation layers
 	#if defined(ENGINE_VL_DEBUG)
 	constexpr auto layers = vulkan::validation_layers::layers();
@@ -68,14 +129,14 @@ vulkan::device::device(void)
 	const vk::device_info info {
 		// structure type
 		.sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-		// next structure
-		.pNext                   = nullptr,
+		// next structure (vulkan 1.2 features)
+		.pNext                   = chain12 == true ? &enabled12 : nullptr,
 		// flags
 		.flags                   = 0U,
 		// number of queue create infos
-		.queueCreateInfoCount    = 1U,
+		.queueCreateInfoCount    = static_cast<vk::u32>(queue_infos.size()),
 		// queue create infos
-		.pQueueCreateInfos       = &queue_info,
+		.pQueueCreateInfos       = queue_infos.data(),
 		// number of enabled layers
 		#if defined(ENGINE_VL_DEBUG)
 		.enabledLayerCount       = layers.size(),
@@ -88,9 +149,9 @@ vulkan::device::device(void)
 		.ppEnabledLayerNames     = nullptr,
 		#endif
 		// number of enabled extensions
-		.enabledExtensionCount   = extensions.size(),
+		.enabledExtensionCount   = static_cast<vk::u32>(enabled.size()),
 		// enabled extensions
-		.ppEnabledExtensionNames = extensions.data(),
+		.ppEnabledExtensionNames = enabled.data(),
 		// enabled features
 		.pEnabledFeatures        = &features
 	};
@@ -125,6 +186,26 @@ auto vulkan::device::family(void) noexcept -> const vk::u32& {
 	return ___self::_shared()._family;
 }
 
+/* transfer queue family */
+auto vulkan::device::transfer_family(void) noexcept -> const vk::u32& {
+	return ___self::_shared()._transfer_family;
+}
+
+/* memory budget */
+auto vulkan::device::memory_budget(void) noexcept -> bool {
+	return ___self::_shared()._memory_budget;
+}
+
+/* draw indirect count */
+auto vulkan::device::draw_indirect_count(void) noexcept -> bool {
+	return ___self::_shared()._draw_indirect_count;
+}
+
+/* timeline semaphore */
+auto vulkan::device::timeline_semaphore(void) noexcept -> bool {
+	return ___self::_shared()._timeline_semaphore;
+}
+
 
 // -- public static methods ---------------------------------------------------
 
@@ -146,9 +227,16 @@ auto vulkan::device::wait_idle(void) -> void {
 /* pick physical device */
 auto vulkan::device::_pick_physical_device(const vk::surface& surface) -> vulkan::physical_device {
 
+	// frame pacing relies on timeline semaphores (core since vulkan 1.2)
+	if (vulkan::instance::version() < VK_API_VERSION_1_2)
+		throw vk::exception{"vulkan 1.2 loader required (timeline semaphores)", VK_ERROR_INCOMPATIBLE_DRIVER};
+
 	// get physical devices
 	const auto& pdevices = vulkan::instance::physical_devices();
 
+	// suitable device rejected for lack of timelines
+	bool outdated = false;
+
 	// loop over devices
 	for (const auto& pdevice : pdevices) {
 
@@ -164,9 +252,40 @@ auto vulkan::device::_pick_physical_device(const vk::surface& surface) -> vulkan
 		&& (properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU
 		 || properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU)) {
 		// &&  features.geometryShader == true) {
-			return pdevice;
+
+			if (___self::_supports_timeline(pdevice) == true)
+				return pdevice;
+
+			outdated = true;
 		}
 	}
+
+	if (outdated == true)
+		throw vk::exception{"no device supports vulkan 1.2 timeline semaphores", VK_ERROR_FEATURE_NOT_PRESENT};
+
 	// no suitable physical device found
 	throw vk::exception{"failed to find suitable physical device"};
 }
+
+/* supports timeline */
+auto vulkan::device::_supports_timeline(const vulkan::physical_device& pdevice) -> bool {
+
+	// features2 query is core since 1.1, the loader is 1.2 here
+	if (pdevice.properties().apiVersion < VK_API_VERSION_1_2)
+		return false;
+
+	vk::physical_device_vulkan12_features supported12 {
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+		.pNext = nullptr
+	};
+
+	vk::physical_device_features2 features2 {
+		.sType    = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+		.pNext    = &supported12,
+		.features = {}
+	};
+
+	::vk_get_physical_device_features2(pdevice, &features2);
+
+	return supported12.timelineSemaphore == VK_TRUE;
+}
@@ -6,13 +6,13 @@
 
 /* default constructor */
 vulkan::device_memory::device_memory(void) noexcept
-: _memory{nullptr} {
+: _memory{nullptr}, _mapped{nullptr} {
 }
 
 /* buffer / properties constructor */
 vulkan::device_memory::device_memory(const vk::buffer& ___bf,
 									 const vk::memory_property_flags& ___properties)
-/* uninitialized device memory */ {
+: /* uninitialized device memory */ _mapped{nullptr} {
 
 	// get device
 	const vk::device& ldevice = vulkan::device::logical();
@@ -44,10 +44,11 @@ vulkan::device_memory::device_memory(const vk::buffer& ___bf,
 
 /* move constructor */
 vulkan::device_memory::device_memory(___self&& ___ot) noexcept
-: _memory{___ot._memory} {
+: _memory{___ot._memory}, _mapped{___ot._mapped} {
 
 	// invalidate other
 	___ot._memory = nullptr;
+	___ot._mapped = nullptr;
 }
 
 /* destructor */
@@ -79,7 +80,9 @@ auto vulkan::device_memory::operator=(___self&& ___ot) noexcept -> ___self& {
 
 	// move assign
 	_memory = ___ot._memory;
+	_mapped = ___ot._mapped;
 	___ot._memory = nullptr;
+	___ot._mapped = nullptr;
 
 	// done
 	return *this;
@@ -113,3 +113,17 @@ auto vulkan::fence::wait(void) -> void {
 			UINT64_MAX
 	);
 }
+
+/* signaled */
+auto vulkan::fence::signaled(void) const -> bool {
+
+	// get fence status (non-blocking)
+	const vk::result result = ::vk_get_fence_status(
+			vulkan::device::logical(), _fence);
+
+	// device lost or out of memory
+	if (result != VK_SUCCESS && result != VK_NOT_READY)
+		throw vk::exception{"failed to get fence status", result};
+
+	return result == VK_SUCCESS;
+}
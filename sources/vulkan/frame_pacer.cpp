@@ -0,0 +1,112 @@
+#include "engine/vulkan/frame_pacer.hpp"
+
+
+// -- public lifecycle --------------------------------------------------------
+
+/* frames in flight constructor */
+vulkan::frame_pacer::frame_pacer(const vk::u32& ___frames)
+: _timeline{0U}, _image_available{}, _render_finished{},
+  _frame{0U}, _frames{1U}, _hooks{} {
+
+	___self::frames(___frames);
+}
+
+
+// -- public methods ----------------------------------------------------------
+
+/* wait current frame */
+auto vulkan::frame_pacer::wait_current_frame(void) const -> void {
+
+	// first frames have nothing to wait for, later ones wait
+	// frame (_frame - _frames), it signaled its number + 1,
+	// slots are never shared by frames in flight (_frames <= max_frames)
+	if (_frame >= _frames)
+		_timeline.wait(_frame - _frames + 1U);
+
+	const vk::u32 slot = ___self::current_frame();
+
+	// previous frame of this slot is done, its resources can be reused
+	for (const auto& hook : _hooks)
+		hook.function(hook.context, slot);
+}
+
+/* wait */
+auto vulkan::frame_pacer::wait(const vk::u64& ___value) const -> void {
+
+	// zero is never signaled, always complete
+	if (___value == 0U)
+		return;
+
+	_timeline.wait(___value);
+}
+
+/* reached */
+auto vulkan::frame_pacer::reached(const vk::u64& ___value) const -> bool {
+	return _timeline.reached(___value);
+}
+
+/* frames */
+auto vulkan::frame_pacer::frames(const vk::u32& ___frames) noexcept -> void {
+
+	// fewer frames only wait longer, no resource is reallocated
+	_frames = ___frames == 0U ? 1U
+			: (___frames > max_frames ? max_frames : ___frames);
+}
+
+/* attach */
+auto vulkan::frame_pacer::attach(const hook_type& ___function, void* ___context) -> void {
+	_hooks.push_back(___hook{___function, ___context});
+}
+
+/* detach */
+auto vulkan::frame_pacer::detach(const void* ___context) noexcept -> void {
+
+	for (auto it = _hooks.begin(); it != _hooks.end();) {
+
+		if (it->context == ___context)
+			it = _hooks.erase(it);
+		else
+			++it;
+	}
+}
+
+
+// -- public accessors --------------------------------------------------------
+
+/* frames */
+auto vulkan::frame_pacer::frames(void) const noexcept -> vk::u32 {
+	return _frames;
+}
+
+/* current frame */
+auto vulkan::frame_pacer::current_frame(void) const noexcept -> vk::u32 {
+	return static_cast<vk::u32>(_frame % max_frames);
+}
+
+/* value */
+auto vulkan::frame_pacer::value(void) const noexcept -> vk::u64 {
+	return _frame + 1U;
+}
+
+/* timeline */
+auto vulkan::frame_pacer::timeline(void) const noexcept -> const vulkan::timeline& {
+	return _timeline;
+}
+
+/* image available */
+auto vulkan::frame_pacer::image_available(void) const noexcept -> const vk::semaphore& {
+	return _image_available[___self::current_frame()].underlying();
+}
+
+/* render finished */
+auto vulkan::frame_pacer::render_finished(void) const noexcept -> const vk::semaphore& {
+	return _render_finished[___self::current_frame()].underlying();
+}
+
+
+// -- public operators --------------------------------------------------------
+
+/* next frame */
+auto vulkan::frame_pacer::operator++(void) noexcept -> void {
+	++_frame;
+}
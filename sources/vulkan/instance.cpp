@@ -24,15 +24,19 @@ auto vulkan::instance::_shared(void) -> ___self& {
 vulkan::instance::instance(void)
 /* uninitialized instance / messenger */ {
 
+	// 1.2 wanted (timeline semaphores), a 1.0 loader rejects anything newer
+	const vk::u32 loader = ___self::_loader_version();
+	_version = loader < VK_API_VERSION_1_2 ? loader : VK_API_VERSION_1_2;
+
 	// create application info
-	constexpr vk::application_info app_info{
+	const vk::application_info app_info{
 		.sType              = VK_STRUCTURE_TYPE_APPLICATION_INFO,
 		.pNext              = nullptr,
 		.pApplicationName   = "application",
 		.applicationVersion = VK_MAKE_API_VERSION(0, 1, 0, 0),
 		.pEngineName        = "renderx",
 		.engineVersion      = VK_MAKE_API_VERSION(0, 1, 0, 0),
-		.apiVersion         = VK_API_VERSION_1_0
+		.apiVersion         = _version
 	};
 
 	// get required extensions (from GLFW)
@@ -135,6 +139,23 @@ vulkan::instance::~instance(void) noexcept {
 
 // -- private static methods --------------------------------------------------
 
+/* loader version */
+auto vulkan::instance::_loader_version(void) -> vk::u32 {
+
+	// vulkan 1.0 loaders do not export it
+	const auto func = reinterpret_cast<vk::pfn_enumerate_instance_version>(
+			::vk_get_instance_proc_addr(nullptr, "vkEnumerateInstanceVersion"));
+
+	if (func == nullptr)
+		return VK_API_VERSION_1_0;
+
+	vk::u32 version = VK_API_VERSION_1_0;
+
+	vk::try_execute<"failed to enumerate instance version">(func, &version);
+
+	return version;
+}
+
 /* extension properties */
 auto vulkan::instance::extension_properties(void) -> vk::vector<vk::extension_properties> {
 	return vk::enumerate_instance_extension_properties();
@@ -154,6 +175,11 @@ auto vulkan::instance::physical_devices(void) -> const vk::vector<vulkan::physic
 	return __pdevices;
 }
 
+/* api version */
+auto vulkan::instance::version(void) -> vk::u32 {
+	return ___self::_shared()._version;
+}
+
 
 
 /* callback */
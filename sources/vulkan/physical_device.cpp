@@ -14,6 +14,8 @@
 #include "engine/vk/functions.hpp"
 #include "engine/exceptions.hpp"
 
+#include <cstring>
+
 
 // -- public lifecycle --------------------------------------------------------
 
@@ -54,6 +56,22 @@ auto vulkan::physical_device::find_queue_family(const vk::surface& surface,
 	throw engine::exception{"failed to find suitable queue family"};
 }
 
+/* find dedicated queue family */
+auto vulkan::physical_device::find_dedicated_queue_family(const vk::queue_flags required,
+														  const vk::queue_flags excluded) const -> vk::u32 {
+	// get queue families properties
+	const auto properties = vk::get_physical_device_queue_family_properties(_pdevice);
+
+	for (vk::u32 i = 0U; i < properties.size(); ++i) {
+		// check queue flags
+		if ((properties[i].queueFlags & required) == required
+		&&  (properties[i].queueFlags & excluded) == 0U) {
+			return i;
+		}
+	}
+	return VK_QUEUE_FAMILY_IGNORED;
+}
+
 /* supports swapchain */
 auto vulkan::physical_device::supports_swapchain(void) const noexcept -> bool {
 	auto extensions = vk::enumerate_device_extension_properties(_pdevice);
@@ -65,6 +83,17 @@ auto vulkan::physical_device::supports_swapchain(void) const noexcept -> bool {
 	return false;
 }
 
+/* supports extension */
+auto vulkan::physical_device::supports_extension(const char* name) const -> bool {
+	auto extensions = vk::enumerate_device_extension_properties(_pdevice);
+
+	for (const auto& extension : extensions) {
+		if (::strcmp(extension.extensionName, name) == 0)
+			return true;
+	}
+	return false;
+}
+
 /* have surface formats */
 auto vulkan::physical_device::have_surface_formats(const vk::surface& surface) const -> bool {
 	return bool{vk::get_physical_device_surface_formats_count(_pdevice, surface) > 0};
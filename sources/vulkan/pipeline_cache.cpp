@@ -0,0 +1,266 @@
+#include "engine/vulkan/pipeline_cache.hpp"
+#include "engine/vk/utils.hpp"
+#include "engine/vulkan/device.hpp"
+#include "engine/os.hpp"
+
+#include "renderx/hash/fnv1a.hpp"
+
+#include <xns/unique_descriptor.hpp>
+
+#include <cstring>
+#include <cstdlib>
+#include <filesystem>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+// -- private constants -------------------------------------------------------
+
+/* application directory (in the cache directory) */
+static constexpr const char* ___directory = "renderx";
+
+/* cache file */
+static constexpr const char* ___file = "pipeline.cache";
+
+/* temporary suffix (renamed over cache file) */
+static constexpr const char* ___temp = ".tmp";
+
+/* magic number ('VKPC') */
+static constexpr vk::u32 ___magic = 0x43504B56U;
+
+
+// -- private static methods --------------------------------------------------
+
+/* shared */
+auto vulkan::pipeline_cache::_shared(void) -> ___self& {
+	static ___self ___ins{};
+	return ___ins;
+}
+
+/* resolve */
+auto vulkan::pipeline_cache::_resolve(void) -> std::string {
+
+	std::filesystem::path directory;
+
+	const char* xdg  = std::getenv("XDG_CACHE_HOME");
+	const char* home = std::getenv("HOME");
+
+	// per user cache directory
+	if (xdg != nullptr && *xdg != '\0')
+		directory = xdg;
+
+	else if (home != nullptr && *home != '\0') {
+		#if defined(ENGINE_OS_MACOS)
+		directory = std::filesystem::path{home} / "Library" / "Caches";
+		#else
+		directory = std::filesystem::path{home} / ".cache";
+		#endif
+	}
+
+	// no home, next to the executable
+	else {
+		std::error_code error;
+		directory = std::filesystem::read_symlink("/proc/self/exe", error).parent_path();
+	}
+
+	directory /= ___directory;
+
+	// missing directory only fails later saves, never startup
+	std::error_code error;
+	std::filesystem::create_directories(directory, error);
+
+	return (directory / ___file).string();
+}
+
+/* load */
+auto vulkan::pipeline_cache::_load(const std::string& ___path) -> std::vector<vk::u8> {
+
+	xns::unique_descriptor file{::open(___path.c_str(), O_RDONLY)};
+
+	// first launch
+	if (not file)
+		return {};
+
+	struct stat stat;
+	if (::fstat(file, &stat) == -1
+		|| static_cast<::size_t>(stat.st_size) < sizeof(___header))
+		return {};
+
+	___header header;
+
+	if (::read(file, &header, sizeof(___header)) != sizeof(___header))
+		return {};
+
+	const ___header expected = ___self::_header();
+
+	// other device, driver update or foreign file
+	if (header.magic  != expected.magic
+	 || header.vendor != expected.vendor
+	 || header.device != expected.device
+	 || header.driver != expected.driver
+	 || std::memcmp(header.uuid, expected.uuid, VK_UUID_SIZE) != 0
+	 || header.size   != static_cast<vk::u64>(stat.st_size) - sizeof(___header)
+	 || header.size   <  sizeof(vk::pipeline_cache_header))
+		return {};
+
+	std::vector<vk::u8> data(static_cast<::size_t>(header.size));
+
+	if (::read(file, data.data(), data.size()) != static_cast<::ssize_t>(data.size()))
+		return {};
+
+	// truncated or corrupted write
+	if (rx::fnv1a(data.data(), data.size()) != header.checksum)
+		return {};
+
+	// driver header must agree with our own
+	vk::pipeline_cache_header driver;
+	std::memcpy(&driver, data.data(), sizeof(vk::pipeline_cache_header));
+
+	if (driver.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+	 || driver.vendorID      != expected.vendor
+	 || driver.deviceID      != expected.device
+	 || std::memcmp(driver.pipelineCacheUUID, expected.uuid, VK_UUID_SIZE) != 0)
+		return {};
+
+	return data;
+}
+
+/* header */
+auto vulkan::pipeline_cache::_header(void) -> ___header {
+
+	const auto properties = vulkan::device::physical().properties();
+
+	___header header {
+		.magic    = ___magic,
+		.vendor   = properties.vendorID,
+		.device   = properties.deviceID,
+		.driver   = properties.driverVersion,
+		.uuid     = {},
+		.size     = 0U,
+		.checksum = 0U
+	};
+
+	std::memcpy(header.uuid, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+	return header;
+}
+
+
+// -- private lifecycle -------------------------------------------------------
+
+/* default constructor */
+vulkan::pipeline_cache::pipeline_cache(void)
+: _path{___self::_resolve()}, _cache{VK_NULL_HANDLE}, _mutex{}, _saved{0U} {
+
+	// previous run data (empty when missing or stale)
+	const auto data = ___self::_load(_path);
+
+	// create info
+	const vk::pipeline_cache_info info {
+		.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+		.pNext           = nullptr,
+		.flags           = 0U,
+		.initialDataSize = data.size(),
+		.pInitialData    = data.empty() ? nullptr : data.data()
+	};
+
+	// create pipeline cache
+	vk::try_execute<"failed to create pipeline cache">(
+			::vk_create_pipeline_cache,
+			vulkan::device::logical(), &info, nullptr, &_cache);
+
+	// nothing new to write yet
+	_saved = data.size();
+}
+
+/* destructor */
+vulkan::pipeline_cache::~pipeline_cache(void) noexcept {
+
+	// last chance to keep compiled pipelines
+	try {
+		___self::_write();
+	}
+	catch (...) {}
+
+	// release pipeline cache
+	::vk_destroy_pipeline_cache(vulkan::device::logical(), _cache, nullptr);
+}
+
+
+// -- private methods ---------------------------------------------------------
+
+/* write */
+auto vulkan::pipeline_cache::_write(void) -> void {
+
+	const auto& device = vulkan::device::logical();
+
+	::size_t size = 0U;
+
+	// query size
+	vk::try_execute<"failed to get pipeline cache size">(
+			::vk_get_pipeline_cache_data,
+			device, _cache, &size, nullptr);
+
+	// cache only grows, same size means nothing new
+	if (size == _saved)
+		return;
+
+	std::vector<vk::u8> data(size);
+
+	// size may shrink between calls, never grow past queried size
+	vk::try_execute<"failed to get pipeline cache data">(
+			::vk_get_pipeline_cache_data,
+			device, _cache, &size, data.data());
+
+	data.resize(size);
+
+	___header header = ___self::_header();
+	header.size     = size;
+	header.checksum = rx::fnv1a(data.data(), size);
+
+	const std::string temp = _path + ___temp;
+
+	{
+		xns::unique_descriptor file{::open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)};
+
+		if (not file)
+			throw vk::exception{"failed to open pipeline cache file"};
+
+		if (::write(file, &header, sizeof(___header)) != sizeof(___header)
+		 || ::write(file, data.data(), size) != static_cast<::ssize_t>(size))
+			throw vk::exception{"failed to write pipeline cache file"};
+
+		// data on disk before rename makes it visible
+		if (::fsync(file) == -1)
+			throw vk::exception{"failed to sync pipeline cache file"};
+	}
+
+	// atomic replace, readers see old or new file, never a partial one
+	if (::rename(temp.c_str(), _path.c_str()) == -1)
+		throw vk::exception{"failed to rename pipeline cache file"};
+
+	_saved = size;
+}
+
+
+// -- public static accessors -------------------------------------------------
+
+/* underlying */
+auto vulkan::pipeline_cache::underlying(void) -> const vk::pipeline_cache& {
+	return ___self::_shared()._cache;
+}
+
+
+// -- public static methods ---------------------------------------------------
+
+/* save */
+auto vulkan::pipeline_cache::save(void) -> void {
+
+	auto& self = ___self::_shared();
+
+	const std::lock_guard lock{self._mutex};
+
+	self._write();
+}
@@ -16,11 +16,24 @@
 
 /* device and queue family constructor */
 vulkan::queue::queue(void) noexcept
-: _queue{nullptr} {
+: ___self{vulkan::device::family()} {
+}
+
+/* family constructor */
+vulkan::queue::queue(const vk::u32& family) noexcept
+: _queue{nullptr}, _family{family} {
 
 	// get device queue
 	::vk_get_device_queue(vulkan::device::logical(),
-						  vulkan::device::family(), 0U, &_queue);
+						  family, 0U, &_queue);
+}
+
+
+// -- public accessors --------------------------------------------------------
+
+/* family */
+auto vulkan::queue::family(void) const noexcept -> const vk::u32& {
+	return _family;
 }
 
 
@@ -45,40 +58,125 @@ auto vulkan::queue::info(const vk::u32 index,
 // -- public methods ----------------------------------------------------------
 
 
-/* submit */ // not thread safe
-auto vulkan::queue::submit(const vk::semaphore& wait,
-						   const vk::semaphore& signal,
-						   const vk::fence& fence,
-						   const vulkan::command_buffer<vulkan::primary>& cmd) const -> void {
+/* submit (no semaphores) */
+auto vulkan::queue::submit(const vulkan::command_buffer<vulkan::primary>& cmd,
+						   const vk::fence& fence) const -> void {
 
-
-	const vk::pipeline_stage_flags wait_stages[] = {
-		VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
+	const vk::submit_info info{
+		// structure type
+		.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext                = nullptr,
+		// wait semaphores
+		.waitSemaphoreCount   = 0U,
+		.pWaitSemaphores      = nullptr,
+		// wait stages
+		.pWaitDstStageMask    = nullptr,
+		// command buffer count
+		.commandBufferCount   = 1U,
+		// command buffers
+		.pCommandBuffers      = &(cmd.underlying()),
+		// signal semaphores
+		.signalSemaphoreCount = 0U,
+		.pSignalSemaphores    = nullptr
 	};
 
+	vk::try_execute<"failed to submit queue">(
+			::vk_queue_submit, _queue, 1U, // submit count
+						&info, fence);
+}
+
+/* submit (timeline, no binary semaphores) */
+auto vulkan::queue::submit(const vulkan::command_buffer<vulkan::primary>& cmd,
+						   const vulkan::timeline& timeline,
+						   const vk::u64& value) const -> void {
+
+	const vk::timeline_semaphore_submit_info values {
+		.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+		.pNext                     = nullptr,
+		.waitSemaphoreValueCount   = 0U,
+		.pWaitSemaphoreValues      = nullptr,
+		.signalSemaphoreValueCount = 1U,
+		.pSignalSemaphoreValues    = &value
+	};
 
 	const vk::submit_info info{
 		// structure type
 		.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-		.pNext                = nullptr,
+		.pNext                = &values,
 		// wait semaphores
+		.waitSemaphoreCount   = 0U,
+		.pWaitSemaphores      = nullptr,
+		// wait stages
+		.pWaitDstStageMask    = nullptr,
+		// command buffer count
+		.commandBufferCount   = 1U,
+		// command buffers
+		.pCommandBuffers      = &(cmd.underlying()),
+		// signal semaphores
+		.signalSemaphoreCount = 1U,
+		.pSignalSemaphores    = &(timeline.underlying())
+	};
+
+	vk::try_execute<"failed to submit queue">(
+			::vk_queue_submit, _queue, 1U, // submit count
+						&info, VK_NULL_HANDLE);
+}
+
+/* submit (timeline handoff) */
+auto vulkan::queue::submit(const vulkan::command_buffer<vulkan::primary>& cmd,
+						   const vulkan::timeline& wait,
+						   const vk::u64& wait_value,
+						   const vk::pipeline_stage_flags& wait_stage,
+						   const vulkan::timeline& signal,
+						   const vk::u64& signal_value) const -> void {
+
+	const vk::timeline_semaphore_submit_info values {
+		.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+		.pNext                     = nullptr,
+		.waitSemaphoreValueCount   = 1U,
+		.pWaitSemaphoreValues      = &wait_value,
+		.signalSemaphoreValueCount = 1U,
+		.pSignalSemaphoreValues    = &signal_value
+	};
+
+	const vk::submit_info info{
+		// structure type
+		.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext                = &values,
+		// wait semaphores (work of another queue)
 		.waitSemaphoreCount   = 1U,
-		.pWaitSemaphores      = &(wait),
+		.pWaitSemaphores      = &(wait.underlying()),
 		// wait stages
-		.pWaitDstStageMask    = wait_stages,
+		.pWaitDstStageMask    = &wait_stage,
 		// command buffer count
 		.commandBufferCount   = 1U,
 		// command buffers
 		.pCommandBuffers      = &(cmd.underlying()),
 		// signal semaphores
 		.signalSemaphoreCount = 1U,
-		.pSignalSemaphores    = &(signal)
+		.pSignalSemaphores    = &(signal.underlying())
 	};
 
-	// see vkQueueSubmit2KHR
 	vk::try_execute<"failed to submit queue">(
-			::vkQueueSubmit, _queue, 1U, // submit count
-						&info, fence);
+			::vk_queue_submit, _queue, 1U, // submit count
+						&info, VK_NULL_HANDLE);
+}
+
+/* submit (batched) */
+auto vulkan::queue::submit(vulkan::submission& submission,
+						   const vk::fence& fence) const -> void {
+
+	const auto& infos = submission.build();
+
+	// nothing to submit, nothing to signal
+	if (infos.empty() == true && fence == VK_NULL_HANDLE)
+		return;
+
+	// one kernel transition for the whole frame
+	vk::try_execute<"failed to submit queue">(
+			::vk_queue_submit, _queue,
+			static_cast<vk::u32>(infos.size()),
+			infos.data(), fence);
 }
 
 /* present */
@@ -0,0 +1,167 @@
+#include "engine/vulkan/submission.hpp"
+
+
+// -- public lifecycle --------------------------------------------------------
+
+/* default constructor */
+vulkan::submission::submission(void)
+: _waits{}, _wait_values{}, _wait_stages{},
+  _cmds{}, _signals{}, _signal_values{},
+  _batches{}, _timelines{}, _infos{} {
+
+	// first batch is open
+	_batches.push_back(___batch{0U, 0U, 0U, 0U, 0U, 0U});
+}
+
+
+// -- public modifiers --------------------------------------------------------
+
+/* wait (binary semaphore) */
+auto vulkan::submission::wait(const vk::semaphore& ___semaphore,
+							  const vk::pipeline_stage_flags& ___stage) -> ___self& {
+
+	_waits.push_back(___semaphore);
+	_wait_values.push_back(0U);
+	_wait_stages.push_back(___stage);
+
+	++___self::_current().wait_count;
+
+	return *this;
+}
+
+/* wait (timeline value) */
+auto vulkan::submission::wait(const vulkan::timeline& ___timeline,
+							  const vk::u64& ___value,
+							  const vk::pipeline_stage_flags& ___stage) -> ___self& {
+
+	_waits.push_back(___timeline.underlying());
+	_wait_values.push_back(___value);
+	_wait_stages.push_back(___stage);
+
+	++___self::_current().wait_count;
+
+	return *this;
+}
+
+/* execute */
+auto vulkan::submission::execute(const vulkan::command_buffer<vulkan::primary>& ___cmd) -> ___self& {
+
+	_cmds.push_back(___cmd.underlying());
+
+	++___self::_current().cmd_count;
+
+	return *this;
+}
+
+/* signal (binary semaphore) */
+auto vulkan::submission::signal(const vk::semaphore& ___semaphore) -> ___self& {
+
+	_signals.push_back(___semaphore);
+	_signal_values.push_back(0U);
+
+	++___self::_current().signal_count;
+
+	return *this;
+}
+
+/* signal (timeline value) */
+auto vulkan::submission::signal(const vulkan::timeline& ___timeline,
+								const vk::u64& ___value) -> ___self& {
+
+	_signals.push_back(___timeline.underlying());
+	_signal_values.push_back(___value);
+
+	++___self::_current().signal_count;
+
+	return *this;
+}
+
+/* next */
+auto vulkan::submission::next(void) -> ___self& {
+
+	// each batch starts where the arrays end
+	_batches.push_back(___batch{
+		static_cast<size_type>(_waits.size()),   0U,
+		static_cast<size_type>(_cmds.size()),    0U,
+		static_cast<size_type>(_signals.size()), 0U
+	});
+
+	return *this;
+}
+
+/* clear */
+auto vulkan::submission::clear(void) noexcept -> void {
+
+	_waits.clear();
+	_wait_values.clear();
+	_wait_stages.clear();
+	_cmds.clear();
+	_signals.clear();
+	_signal_values.clear();
+	_timelines.clear();
+	_infos.clear();
+
+	// keep the open batch
+	_batches.resize(1U);
+	_batches[0U] = ___batch{0U, 0U, 0U, 0U, 0U, 0U};
+}
+
+
+// -- public methods ----------------------------------------------------------
+
+/* build */
+auto vulkan::submission::build(void) -> const std::vector<vk::submit_info>& {
+
+	_timelines.clear();
+	_infos.clear();
+
+	// infos point into timelines, no reallocation while filling
+	_timelines.reserve(_batches.size());
+	_infos.reserve(_batches.size());
+
+	for (const auto& batch : _batches) {
+
+		if (batch.wait_count == 0U && batch.cmd_count == 0U && batch.signal_count == 0U)
+			continue;
+
+		// binary semaphores ignore their value
+		_timelines.push_back(vk::timeline_semaphore_submit_info{
+			.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+			.pNext                     = nullptr,
+			.waitSemaphoreValueCount   = batch.wait_count,
+			.pWaitSemaphoreValues      = _wait_values.data() + batch.wait_first,
+			.signalSemaphoreValueCount = batch.signal_count,
+			.pSignalSemaphoreValues    = _signal_values.data() + batch.signal_first
+		});
+
+		_infos.push_back(vk::submit_info{
+			.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			.pNext                = &_timelines.back(),
+			.waitSemaphoreCount   = batch.wait_count,
+			.pWaitSemaphores      = _waits.data() + batch.wait_first,
+			.pWaitDstStageMask    = _wait_stages.data() + batch.wait_first,
+			.commandBufferCount   = batch.cmd_count,
+			.pCommandBuffers      = _cmds.data() + batch.cmd_first,
+			.signalSemaphoreCount = batch.signal_count,
+			.pSignalSemaphores    = _signals.data() + batch.signal_first
+		});
+	}
+
+	return _infos;
+}
+
+
+// -- public accessors --------------------------------------------------------
+
+/* empty */
+auto vulkan::submission::empty(void) const noexcept -> bool {
+	return _waits.empty() && _cmds.empty() && _signals.empty();
+}
+
+
+// -- private methods ---------------------------------------------------------
+
+/* current batch */
+auto vulkan::submission::_current(void) noexcept -> ___batch& {
+	return _batches.back();
+}
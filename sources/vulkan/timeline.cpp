@@ -0,0 +1,128 @@
+#include "engine/vulkan/timeline.hpp"
+#include "engine/vk/utils.hpp"
+#include "engine/vulkan/device.hpp"
+
+
+
+// -- public lifecycle --------------------------------------------------------
+
+/* initial value constructor */
+vulkan::timeline::timeline(const vk::u64& ___initial)
+/* uninitialized semaphore */ {
+
+	// core since vulkan 1.2, enabled by the device when supported
+	if (vulkan::device::timeline_semaphore() == false)
+		throw vk::exception{"timeline semaphores not supported", VK_ERROR_FEATURE_NOT_PRESENT};
+
+	// semaphore type
+	const vk::semaphore_type_info type {
+		.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+		.pNext         = nullptr,
+		.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+		.initialValue  = ___initial
+	};
+
+	// create info
+	const vk::semaphore_info info {
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+		.pNext = &type,
+		.flags = 0U
+	};
+
+	// create semaphore
+	vk::try_execute<"failed to create timeline semaphore">(
+			::vk_create_semaphore,
+			vulkan::device::logical(), &info, nullptr, &_semaphore);
+}
+
+/* move constructor */
+vulkan::timeline::timeline(___self&& ___ot) noexcept
+: _semaphore{___ot._semaphore} {
+
+	// invalidate other
+	___ot._semaphore = nullptr;
+}
+
+/* destructor */
+vulkan::timeline::~timeline(void) noexcept {
+
+	if (_semaphore == nullptr)
+		return;
+
+	// release semaphore
+	::vk_destroy_semaphore(vulkan::device::logical(),
+			_semaphore, nullptr);
+}
+
+
+// -- public assignment operators ---------------------------------------------
+
+/* move assignment operator */
+auto vulkan::timeline::operator=(___self&& ___ot) noexcept -> ___self& {
+
+	// check for self-assignment
+	if (this == &___ot)
+		return *this;
+
+	// release semaphore
+	if (_semaphore != nullptr)
+		::vk_destroy_semaphore(vulkan::device::logical(),
+				_semaphore, nullptr);
+
+	// move semaphore
+	_semaphore = ___ot._semaphore;
+
+	// invalidate other
+	___ot._semaphore = nullptr;
+
+	// done
+	return *this;
+}
+
+
+// -- public accessors --------------------------------------------------------
+
+/* underlying */
+auto vulkan::timeline::underlying(void) const noexcept -> const vk::semaphore& {
+	return _semaphore;
+}
+
+
+// -- public methods ----------------------------------------------------------
+
+/* wait */
+auto vulkan::timeline::wait(const vk::u64& ___value) const -> void {
+
+	// wait info
+	const vk::semaphore_wait_info info {
+		.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+		.pNext          = nullptr,
+		.flags          = 0U,
+		.semaphoreCount = 1U,
+		.pSemaphores    = &_semaphore,
+		.pValues        = &___value
+	};
+
+	// block until counter reaches value
+	vk::try_execute<"failed to wait for timeline semaphore">(
+			::vk_wait_semaphores,
+			vulkan::device::logical(), &info, UINT64_MAX);
+}
+
+/* completed */
+auto vulkan::timeline::completed(void) const -> vk::u64 {
+
+	vk::u64 value = 0U;
+
+	// get counter value (non-blocking)
+	vk::try_execute<"failed to get timeline semaphore value">(
+			::vk_get_semaphore_counter_value,
+			vulkan::device::logical(), _semaphore, &value);
+
+	return value;
+}
+
+/* reached */
+auto vulkan::timeline::reached(const vk::u64& ___value) const -> bool {
+	return ___self::completed() >= ___value;
+}